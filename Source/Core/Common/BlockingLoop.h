@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 
+#include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 
@@ -46,6 +49,9 @@ public:
       return;
 
     // Else as the worker thread may sleep now, we have to set the event.
+    m_num_wakeups++;
+    if (m_adaptive_spin)
+      m_wakeup_time.store(Now());
     m_new_work_event.Set();
   }
 
@@ -54,7 +60,7 @@ public:
   void Wait()
   {
     // already done
-    if (IsDone())
+    if (IsDone() || SpinUntilDone())
       return;
 
     // notifying this event will only wake up one thread, so use a mutex here to
@@ -80,7 +86,7 @@ public:
   void WaitYield(const std::chrono::duration<Rep, Period>& rel_time, Functor yield_func)
   {
     // already done
-    if (IsDone())
+    if (IsDone() || SpinUntilDone())
       return;
 
     // notifying this event will only wake up one thread, so use a mutex here to
@@ -162,7 +168,18 @@ public:
       case STATE_DONE:
         // We're done now. So time to check if we want to sleep or if we want to stay in a busy
         // loop.
-        if (m_may_sleep.TestAndClear())
+        if (m_adaptive_spin)
+        {
+          // Instead of busy looping until AllowSleep() is called, only spin for about as long as
+          // a wakeup would take. Wakeup() is just an atomic exchange while we're in this state.
+          if (SpinForNewWork())
+            break;
+
+          // Try to set the sleeping state.
+          if (m_running_state-- != STATE_DONE)
+            break;
+        }
+        else if (m_may_sleep.TestAndClear())
         {
           // Try to set the sleeping state.
           if (m_running_state-- != STATE_DONE)
@@ -184,6 +201,8 @@ public:
         {
           m_new_work_event.Wait();
         }
+        if (m_adaptive_spin)
+          UpdateSpinTime();
         break;
       }
     }
@@ -227,11 +246,90 @@ public:
 
   bool IsRunning() const { return !m_stopped.IsSet() && !m_shutdown.IsSet(); }
   bool IsDone() const { return m_stopped.IsSet() || m_running_state.load() <= STATE_DONE; }
+  bool IsSleeping() const { return m_running_state.load() == STATE_SLEEPING; }
   // This function should be triggered regularly over time so
   // that we will fall back from the busy loop to sleeping.
   void AllowSleep() { m_may_sleep.Set(); }
 
+  // When enabled, the worker no longer busy loops until AllowSleep() is called. Instead it spins
+  // briefly before sleeping, and Wait() spins briefly before blocking. The spin time follows the
+  // measured latency from Wakeup() setting the event to the worker running again, and shrinks
+  // while spinning doesn't catch any new work.
+  // Must not be changed while Run() is active.
+  void SetAdaptiveSpin(bool enabled) { m_adaptive_spin = enabled; }
+  // Number of times Wakeup() had to wake a sleeping worker thread.
+  u64 GetWakeupCount() const { return m_num_wakeups.load(); }
+  std::chrono::nanoseconds GetSpinTime() const
+  {
+    return std::chrono::nanoseconds(m_spin_time.load());
+  }
+
 private:
+  // Wakeup latencies above this are usually caused by the scheduler rather than by the wakeup
+  // itself, so spinning for that long wouldn't pay off.
+  static constexpr s64 MAX_SPIN_TIME_NS = 50000;
+
+  static s64 Now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Returns true if new work arrived while spinning.
+  bool SpinForNewWork()
+  {
+    const s64 spin_time = m_spin_time.load();
+    const s64 start = Now();
+    m_spin_start_time = start;
+    if (spin_time == 0)
+      return false;
+
+    do
+    {
+      if (m_running_state.load() != STATE_DONE)
+        return true;
+      std::this_thread::yield();
+    } while (Now() - start < spin_time);
+
+    // The spin was wasted. Spin for less next time, until a wakeup shows it would have paid off.
+    m_spin_time.store(spin_time / 2);
+    return false;
+  }
+
+  bool SpinUntilDone()
+  {
+    if (!m_adaptive_spin)
+      return false;
+
+    const s64 spin_time = m_spin_time.load();
+    const s64 start = Now();
+    while (Now() - start < spin_time)
+    {
+      if (IsDone())
+        return true;
+      std::this_thread::yield();
+    }
+    return false;
+  }
+
+  // Called by the worker after sleeping.
+  void UpdateSpinTime()
+  {
+    const s64 wakeup_time = m_wakeup_time.exchange(0);
+    if (wakeup_time == 0)
+      return;
+
+    // Smooth the latency, as single wakeups are noisy.
+    const s64 now = Now();
+    const s64 latency = std::min(now - wakeup_time, MAX_SPIN_TIME_NS);
+    m_wakeup_latency = m_wakeup_latency == 0 ? latency : (m_wakeup_latency * 7 + latency) / 8;
+
+    // If the work arrived sooner than the wakeup took, spinning would have caught it.
+    if (wakeup_time - m_spin_start_time <= m_wakeup_latency)
+      m_spin_time.store(m_wakeup_latency);
+  }
+
   std::mutex m_wait_lock;
   std::mutex m_prepare_lock;
 
@@ -252,5 +350,14 @@ private:
 
   Flag m_may_sleep;  // If this is set, we fall back from the busy loop to an event based
                      // synchronization.
+
+  std::atomic<u64> m_num_wakeups{0};
+
+  bool m_adaptive_spin = false;
+  std::atomic<s64> m_spin_time{0};
+  std::atomic<s64> m_wakeup_time{0};
+  // Only used by the worker thread.
+  s64 m_wakeup_latency = 0;
+  s64 m_spin_start_time = 0;
 };
 }  // namespace Common
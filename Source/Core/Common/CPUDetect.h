@@ -47,6 +47,7 @@ struct CPUInfo
   bool bFMA = false;
   bool bFMA4 = false;
   bool bAES = false;
+  bool bPCLMULQDQ = false;
   // FXSAVE/FXRSTOR
   bool bFXSR = false;
   bool bMOVBE = false;
@@ -58,12 +59,14 @@ struct CPUInfo
   bool bAtom = false;
   bool bZen1p2 = false;
 
+  // SHA-1 and SHA-256 instructions, which x86 only has together
+  bool bSHA1 = false;
+  bool bSHA2 = false;
+
   // ARMv8 specific
   bool bFP = false;
   bool bASIMD = false;
   bool bCRC32 = false;
-  bool bSHA1 = false;
-  bool bSHA2 = false;
 
   // Call Detect()
   explicit CPUInfo();
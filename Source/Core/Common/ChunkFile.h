@@ -54,6 +54,11 @@ public:
 
 public:
   PointerWrap(u8** ptr_, Mode mode_) : ptr(ptr_), mode(mode_) {}
+  // Switches to MODE_MEASURE instead of accessing more than size bytes. The pointer keeps being
+  // advanced, so that it ends up at the size that would have been needed.
+  PointerWrap(u8** ptr_, size_t size, Mode mode_) : ptr(ptr_), mode(mode_), m_ptr_end(*ptr_ + size)
+  {
+  }
   void SetMode(Mode mode_) { mode = mode_; }
   Mode GetMode() const { return mode; }
   template <typename K, class V>
@@ -305,6 +310,9 @@ private:
 
   DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
   {
+    if (m_ptr_end && mode != MODE_MEASURE && size > static_cast<size_t>(m_ptr_end - *ptr))
+      mode = MODE_MEASURE;
+
     switch (mode)
     {
     case MODE_READ:
@@ -327,4 +335,6 @@ private:
 
     *ptr += size;
   }
+
+  u8* m_ptr_end = nullptr;
 };
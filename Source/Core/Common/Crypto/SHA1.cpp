@@ -0,0 +1,245 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/Crypto/SHA1.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <mbedtls/sha1.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#include "Common/Swap.h"
+
+#if defined(_M_ARM_64) && (defined(__ARM_FEATURE_CRYPTO) || defined(_MSC_VER))
+#define HAS_ARM_SHA1
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace Common::SHA1
+{
+using ProcessBlocksFunction = void (*)(u32* state, const u8* blocks, size_t num_blocks);
+
+static void ProcessBlocksGeneric(u32* state, const u8* blocks, size_t num_blocks)
+{
+  mbedtls_sha1_context context;
+  mbedtls_sha1_init(&context);
+  std::copy_n(state, 5, context.state);
+  for (size_t i = 0; i < num_blocks; ++i)
+    mbedtls_internal_sha1_process(&context, blocks + i * 64);
+  std::copy_n(context.state, 5, state);
+  mbedtls_sha1_free(&context);
+}
+
+#ifdef _M_X86_64
+// The message schedule, four words at a time. W[i] for i >= 4 is computed from the previous four
+// groups and replaces W[i - 4] in w.
+FUNCTION_TARGET_SHA static inline __m128i Schedule(__m128i* w, int i)
+{
+  if (i >= 4)
+  {
+    w[i % 4] = _mm_sha1msg2_epu32(
+        _mm_xor_si128(_mm_sha1msg1_epu32(w[i % 4], w[(i + 1) % 4]), w[(i + 2) % 4]),
+        w[(i + 3) % 4]);
+  }
+  return w[i % 4];
+}
+
+// Four rounds with the round function and constant of group F, which must be a constant.
+template <int F>
+FUNCTION_TARGET_SHA static inline void Rounds(__m128i* abcd, __m128i* e, __m128i* saved_abcd,
+                                              __m128i w, bool first)
+{
+  // The first group of rounds adds E directly, later groups add the rotated A of the previous
+  // group, which sha1nexte computes.
+  const __m128i e_plus_w = first ? _mm_add_epi32(*e, w) : _mm_sha1nexte_epu32(*saved_abcd, w);
+  *saved_abcd = *abcd;
+  *abcd = _mm_sha1rnds4_epu32(*abcd, e_plus_w, F);
+}
+
+FUNCTION_TARGET_SHA
+static void ProcessBlocksSHANI(u32* state, const u8* blocks, size_t num_blocks)
+{
+  // Reverses the bytes of the whole vector, which byteswaps the words and puts the first word in
+  // the highest lane, like ABCD below.
+  const __m128i byteswap_mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+  __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1b);
+  __m128i e = _mm_set_epi32(state[4], 0, 0, 0);
+
+  for (size_t block = 0; block < num_blocks; ++block)
+  {
+    const u8* data = blocks + block * 64;
+    const __m128i abcd_before = abcd;
+    const __m128i e_before = e;
+
+    __m128i w[4];
+    for (int i = 0; i < 4; ++i)
+    {
+      w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)),
+                              byteswap_mask);
+    }
+
+    __m128i saved_abcd = abcd;
+    for (int i = 0; i < 5; ++i)
+      Rounds<0>(&abcd, &e, &saved_abcd, Schedule(w, i), i == 0);
+    for (int i = 5; i < 10; ++i)
+      Rounds<1>(&abcd, &e, &saved_abcd, Schedule(w, i), false);
+    for (int i = 10; i < 15; ++i)
+      Rounds<2>(&abcd, &e, &saved_abcd, Schedule(w, i), false);
+    for (int i = 15; i < 20; ++i)
+      Rounds<3>(&abcd, &e, &saved_abcd, Schedule(w, i), false);
+
+    e = _mm_sha1nexte_epu32(saved_abcd, e_before);
+    abcd = _mm_add_epi32(abcd, abcd_before);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1b));
+  state[4] = _mm_extract_epi32(e, 3);
+}
+#endif
+
+#ifdef HAS_ARM_SHA1
+static void ProcessBlocksARMv8(u32* state, const u8* blocks, size_t num_blocks)
+{
+  const uint32x4_t k[4] = {vdupq_n_u32(0x5a827999), vdupq_n_u32(0x6ed9eba1),
+                           vdupq_n_u32(0x8f1bbcdc), vdupq_n_u32(0xca62c1d6)};
+
+  uint32x4_t abcd = vld1q_u32(state);
+  u32 e = state[4];
+
+  for (size_t block = 0; block < num_blocks; ++block)
+  {
+    const u8* data = blocks + block * 64;
+    const uint32x4_t abcd_before = abcd;
+    const u32 e_before = e;
+
+    uint32x4_t w[4];
+    for (int i = 0; i < 4; ++i)
+      w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i * 16)));
+
+    for (int i = 0; i < 20; ++i)
+    {
+      if (i >= 4)
+      {
+        w[i % 4] = vsha1su1q_u32(vsha1su0q_u32(w[i % 4], w[(i + 1) % 4], w[(i + 2) % 4]),
+                                 w[(i + 3) % 4]);
+      }
+
+      const uint32x4_t w_plus_k = vaddq_u32(w[i % 4], k[i / 5]);
+      const u32 next_e = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+      if (i < 5)
+        abcd = vsha1cq_u32(abcd, e, w_plus_k);
+      else if (i >= 10 && i < 15)
+        abcd = vsha1mq_u32(abcd, e, w_plus_k);
+      else
+        abcd = vsha1pq_u32(abcd, e, w_plus_k);
+      e = next_e;
+    }
+
+    abcd = vaddq_u32(abcd, abcd_before);
+    e += e_before;
+  }
+
+  vst1q_u32(state, abcd);
+  state[4] = e;
+}
+#endif
+
+static ProcessBlocksFunction GetProcessBlocksFunction()
+{
+#ifdef _M_X86_64
+  if (cpu_info.bSHA1 && cpu_info.bSSE4_1)
+    return ProcessBlocksSHANI;
+#endif
+#ifdef HAS_ARM_SHA1
+  if (cpu_info.bSHA1)
+    return ProcessBlocksARMv8;
+#endif
+  return ProcessBlocksGeneric;
+}
+
+static void ProcessBlocks(u32* state, const u8* blocks, size_t num_blocks)
+{
+  static const ProcessBlocksFunction function = GetProcessBlocksFunction();
+  function(state, blocks, num_blocks);
+}
+
+Context::Context() : m_state{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0}
+{
+}
+
+void Context::Update(const u8* msg, size_t len)
+{
+  m_length += len;
+
+  if (m_block_used != 0)
+  {
+    const size_t copy_len = std::min(len, BLOCK_LEN - m_block_used);
+    std::memcpy(m_block.data() + m_block_used, msg, copy_len);
+    m_block_used += copy_len;
+    msg += copy_len;
+    len -= copy_len;
+
+    if (m_block_used != BLOCK_LEN)
+      return;
+    ProcessBlocks(m_state.data(), m_block.data(), 1);
+    m_block_used = 0;
+  }
+
+  const size_t num_blocks = len / BLOCK_LEN;
+  if (num_blocks != 0)
+    ProcessBlocks(m_state.data(), msg, num_blocks);
+
+  m_block_used = len % BLOCK_LEN;
+  std::memcpy(m_block.data(), msg + num_blocks * BLOCK_LEN, m_block_used);
+}
+
+Digest Context::Finish()
+{
+  const u64 length_bits = Common::swap64(m_length * 8);
+
+  // Pad with a one bit and zeros, so that the length fits at the end of the last block.
+  std::array<u8, BLOCK_LEN * 2> padding{};
+  padding[0] = 0x80;
+  const size_t padding_len = (m_block_used < BLOCK_LEN - 8 ? BLOCK_LEN : BLOCK_LEN * 2) -
+                             m_block_used - sizeof(length_bits);
+  Update(padding.data(), padding_len);
+  Update(reinterpret_cast<const u8*>(&length_bits), sizeof(length_bits));
+
+  Digest digest;
+  for (size_t i = 0; i < m_state.size(); ++i)
+  {
+    const u32 word = Common::swap32(m_state[i]);
+    std::memcpy(digest.data() + i * sizeof(word), &word, sizeof(word));
+  }
+  return digest;
+}
+
+Digest CalculateDigest(const u8* msg, size_t len)
+{
+  Context context;
+  context.Update(msg, len);
+  return context.Finish();
+}
+
+const char* GetImplementationName()
+{
+  const ProcessBlocksFunction function = GetProcessBlocksFunction();
+#ifdef _M_X86_64
+  if (function == ProcessBlocksSHANI)
+    return "SHA extensions";
+#endif
+#ifdef HAS_ARM_SHA1
+  if (function == ProcessBlocksARMv8)
+    return "ARMv8 cryptography extension";
+#endif
+  return "mbedtls";
+}
+}  // namespace Common::SHA1
@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// SHA-1 using the SHA extensions on x86 and the cryptography extension on ARMv8 when the CPU has
+// them, and mbedtls otherwise.
+namespace Common::SHA1
+{
+constexpr size_t DIGEST_LEN = 20;
+using Digest = std::array<u8, DIGEST_LEN>;
+
+class Context
+{
+public:
+  Context();
+
+  void Update(const u8* msg, size_t len);
+  Digest Finish();
+
+private:
+  static constexpr size_t BLOCK_LEN = 64;
+
+  std::array<u32, 5> m_state;
+  std::array<u8, BLOCK_LEN> m_block;
+  size_t m_block_used = 0;
+  u64 m_length = 0;
+};
+
+Digest CalculateDigest(const u8* msg, size_t len);
+
+// Returns the name of the implementation that is used on this CPU.
+const char* GetImplementationName();
+}  // namespace Common::SHA1
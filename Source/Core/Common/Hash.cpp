@@ -6,6 +6,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <xxhash.h>
+#include <zlib.h>
+
 #include "Common/BitUtils.h"
 #include "Common/CPUDetect.h"
 #include "Common/CommonFuncs.h"
@@ -505,6 +508,17 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 }
 #endif
 
+// Used when no hardware CRC32 is available. Full-content hashes (samples == 0) go through XXH64,
+// which is considerably faster than MurmurHash3 for large textures; sampled hashes keep using
+// MurmurHash3 since XXH64 has no notion of sampling.
+static u64 GetXXH64OrMurmurHash3(const u8* src, u32 len, u32 samples)
+{
+  if (samples == 0)
+    return XXH64(src, len, 0);
+
+  return GetMurmurHash3(src, len, samples);
+}
+
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
   return ptrHashFunction(src, len, samples);
@@ -527,7 +541,126 @@ void SetHash64Function()
   else
 #endif
   {
-    ptrHashFunction = &GetMurmurHash3;
+    ptrHashFunction = &GetXXH64OrMurmurHash3;
+  }
+}
+
+static u32 UpdateCRC32Generic(u32 crc, const u8* data, size_t length)
+{
+  // It would be nice to use crc32_z here instead of crc32, but it isn't available on Android
+  while (length > 0)
+  {
+    const unsigned int chunk_length = static_cast<unsigned int>(std::min<size_t>(length, 1 << 30));
+    crc = static_cast<u32>(crc32(crc, data, chunk_length));
+    data += chunk_length;
+    length -= chunk_length;
+  }
+  return crc;
+}
+
+#if defined(_M_X86_64)
+// Multiplies both halves of x by the matching constant in k, and adds the products to next.
+FUNCTION_TARGET_PCLMUL static inline __m128i FoldCRC32Block(__m128i x, __m128i k, __m128i next)
+{
+  const __m128i low = _mm_clmulepi64_si128(x, k, 0x00);
+  const __m128i high = _mm_clmulepi64_si128(x, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+// Folds 64 bytes at a time with carry-less multiplication, then reduces the remainder with a
+// Barrett reduction, as described in Intel's "Fast CRC Computation for Generic Polynomials Using
+// PCLMULQDQ Instruction". The constants are for the bit-reflected zlib polynomial. Requires a
+// length of at least 64 which is a multiple of 16, and takes and returns the inverted CRC.
+FUNCTION_TARGET_PCLMUL
+static u32 FoldCRC32(u32 crc, const u8* data, size_t length)
+{
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+  const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+  const __m128i low_words = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  const auto load = [](const u8* ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+  };
+
+  __m128i x0 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  __m128i x1 = load(data + 16);
+  __m128i x2 = load(data + 32);
+  __m128i x3 = load(data + 48);
+  data += 64;
+  length -= 64;
+
+  while (length >= 64)
+  {
+    x0 = FoldCRC32Block(x0, k1k2, load(data));
+    x1 = FoldCRC32Block(x1, k1k2, load(data + 16));
+    x2 = FoldCRC32Block(x2, k1k2, load(data + 32));
+    x3 = FoldCRC32Block(x3, k1k2, load(data + 48));
+    data += 64;
+    length -= 64;
   }
+
+  x0 = FoldCRC32Block(x0, k3k4, x1);
+  x0 = FoldCRC32Block(x0, k3k4, x2);
+  x0 = FoldCRC32Block(x0, k3k4, x3);
+  while (length >= 16)
+  {
+    x0 = FoldCRC32Block(x0, k3k4, load(data));
+    data += 16;
+    length -= 16;
+  }
+
+  // Fold 128 bits to 64 bits.
+  x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), _mm_clmulepi64_si128(x0, k3k4, 0x10));
+  x0 = _mm_xor_si128(_mm_srli_si128(x0, 4),
+                     _mm_clmulepi64_si128(_mm_and_si128(x0, low_words), k5, 0x00));
+
+  // Barrett reduction to 32 bits.
+  __m128i t = _mm_clmulepi64_si128(_mm_and_si128(x0, low_words), poly, 0x10);
+  t = _mm_clmulepi64_si128(_mm_and_si128(t, low_words), poly, 0x00);
+  return static_cast<u32>(_mm_extract_epi32(_mm_xor_si128(x0, t), 1));
+}
+
+static u32 UpdateCRC32PCLMUL(u32 crc, const u8* data, size_t length)
+{
+  if (length >= 64)
+  {
+    const size_t fold_length = length & ~size_t(15);
+    crc = ~FoldCRC32(~crc, data, fold_length);
+    data += fold_length;
+    length -= fold_length;
+  }
+  return UpdateCRC32Generic(crc, data, length);
+}
+#elif defined(_M_ARM_64)
+static u32 UpdateCRC32ARMv8(u32 crc, const u8* data, size_t length)
+{
+  crc = ~crc;
+  for (; length >= sizeof(u64); length -= sizeof(u64), data += sizeof(u64))
+  {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    crc = __crc32d(crc, value);
+  }
+  for (; length > 0; --length, ++data)
+    crc = __crc32b(crc, *data);
+  return ~crc;
+}
+#endif
+
+u32 UpdateCRC32(u32 crc, const u8* data, size_t length)
+{
+  static const auto function = [] {
+#if defined(_M_X86_64)
+    if (cpu_info.bPCLMULQDQ && cpu_info.bSSE4_1)
+      return &UpdateCRC32PCLMUL;
+#elif defined(_M_ARM_64)
+    if (cpu_info.bCRC32)
+      return &UpdateCRC32ARMv8;
+#endif
+    return &UpdateCRC32Generic;
+  }();
+  return function(crc, data, length);
 }
 }  // namespace Common
@@ -15,4 +15,7 @@ u32 HashAdler32(const u8* data, size_t len);         // Fairly accurate, slightl
 u32 HashEctor(const u8* ptr, size_t length);         // JUNK. DO NOT USE FOR NEW THINGS
 u64 GetHash64(const u8* src, u32 len, u32 samples);
 void SetHash64Function();
+
+// Continues the zlib-compatible CRC-32 of a stream, as used by zip files and Redump. Start with 0.
+u32 UpdateCRC32(u32 crc, const u8* data, size_t length);
 }  // namespace Common
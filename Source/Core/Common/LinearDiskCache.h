@@ -112,6 +112,7 @@ public:
     return 0;
   }
 
+  bool IsOpen() const { return m_file.IsOpen(); }
   void Sync() { m_file.Flush(); }
   void Close()
   {
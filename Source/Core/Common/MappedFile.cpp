@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/MappedFile.h"
+
+#include <cstdio>
+#include <utility>
+
+#include "Common/CommonFuncs.h"
+#include "Common/File.h"
+#include "Common/Logging/Log.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace File
+{
+MappedFile::MappedFile() = default;
+
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+  Swap(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+  Swap(other);
+  return *this;
+}
+
+void MappedFile::Swap(MappedFile& other) noexcept
+{
+  std::swap(m_data, other.m_data);
+  std::swap(m_size, other.m_size);
+#ifdef _WIN32
+  std::swap(m_mapping_handle, other.m_mapping_handle);
+#endif
+}
+
+bool MappedFile::Map(IOFile& file)
+{
+  Unmap();
+
+  const u64 size = file.GetSize();
+  if (!file.IsOpen() || size == 0 || size != static_cast<size_t>(size))
+    return false;
+
+#ifdef _WIN32
+  const HANDLE file_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file.GetHandle())));
+  if (file_handle == INVALID_HANDLE_VALUE)
+    return false;
+
+  const HANDLE mapping_handle =
+      CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping_handle)
+  {
+    WARN_LOG_FMT(COMMON, "CreateFileMapping failed: {}", GetLastError());
+    return false;
+  }
+
+  void* data = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    WARN_LOG_FMT(COMMON, "MapViewOfFile failed: {}", GetLastError());
+    CloseHandle(mapping_handle);
+    return false;
+  }
+
+  m_mapping_handle = mapping_handle;
+#else
+  void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(file.GetHandle()), 0);
+  if (data == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "mmap failed: {}", LastStrerrorString());
+    return false;
+  }
+#endif
+
+  m_data = static_cast<const u8*>(data);
+  m_size = size;
+  return true;
+}
+
+void MappedFile::Unmap()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping_handle);
+  m_mapping_handle = nullptr;
+#else
+  munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+
+}  // namespace File
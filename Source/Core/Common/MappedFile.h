@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// A read-only memory mapping of a whole file. The mapping stays valid after the file is closed.
+// Reading through the mapping avoids a system call and a copy for every read, but if another
+// process truncates the file, accessing the missing part raises SIGBUS (or an access violation).
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  void Swap(MappedFile& other) noexcept;
+
+  // Fails for empty files, and on platforms or file systems that don't support mapping.
+  bool Map(IOFile& file);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+
+  // Returns nullptr if the range isn't entirely inside the file.
+  const u8* GetData(u64 offset, u64 size) const
+  {
+    if (!m_data || offset > m_size || size > m_size - offset)
+      return nullptr;
+    return m_data + offset;
+  }
+
+private:
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+};
+
+}  // namespace File
@@ -140,6 +140,8 @@ void CPUInfo::Detect()
       bMOVBE = true;
     if ((cpu_id[2] >> 25) & 1)
       bAES = true;
+    if ((cpu_id[2] >> 1) & 1)
+      bPCLMULQDQ = true;
 
     if ((cpu_id[3] >> 24) & 1)
     {
@@ -171,6 +173,11 @@ void CPUInfo::Detect()
         bBMI1 = true;
       if ((cpu_id[1] >> 8) & 1)
         bBMI2 = true;
+      if ((cpu_id[1] >> 29) & 1)
+      {
+        bSHA1 = true;
+        bSHA2 = true;
+      }
     }
   }
 
@@ -270,6 +277,10 @@ std::string CPUInfo::Summarize()
     sum += ", FMA";
   if (bAES)
     sum += ", AES";
+  if (bPCLMULQDQ)
+    sum += ", PCLMULQDQ";
+  if (bSHA1)
+    sum += ", SHA";
   if (bMOVBE)
     sum += ", MOVBE";
   if (bLongMode)
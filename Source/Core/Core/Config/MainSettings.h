@@ -70,6 +70,7 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<bool> MAIN_ADAPTIVE_GPU_HANDOFF;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FPRF;
@@ -89,6 +90,13 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// States compressed with a dictionary can only be loaded along with it
+extern const Info<bool> MAIN_STATE_COMPRESSION_DICTIONARY;
+extern const Info<bool> MAIN_REWIND_ENABLED;
+// In frames
+extern const Info<int> MAIN_REWIND_INTERVAL;
+// In MiB
+extern const Info<int> MAIN_REWIND_MEMORY_LIMIT;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 
 // Main.DSP
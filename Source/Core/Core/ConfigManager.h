@@ -138,6 +138,7 @@ struct SConfig
   int iSyncGpuMaxDistance;
   int iSyncGpuMinDistance;
   float fSyncGpuOverclock;
+  bool bAdaptiveGpuHandoff = false;
 
   int SelectedLanguage = 0;
   bool bOverrideRegionSettings = false;
@@ -5,9 +5,11 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -22,6 +24,7 @@
 #include "Core/PowerPC/PowerPC.h"
 
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/VideoBackendBase.h"
 
 namespace CoreTiming
@@ -64,6 +67,9 @@ static u64 s_event_fifo_id;
 static std::mutex s_ts_write_lock;
 static Common::SPSCQueue<Event, false> s_ts_queue;
 
+// Functions that run at the end of the current Advance()
+static std::vector<std::function<void()>> s_after_events;
+
 static float s_last_OC_factor;
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
@@ -145,6 +151,7 @@ void Shutdown()
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
+  s_after_events.clear();
 }
 
 void DoState(PointerWrap& p)
@@ -313,6 +320,9 @@ void MoveEvents()
 
 void Advance()
 {
+  // The CPU emulation stage only ends when emulation stops, so account for it every slice.
+  StageTimers::Checkpoint();
+
   MoveEvents();
 
   int cyclesExecuted = g.slice_length - DowncountToCycles(PowerPC::ppcState.downcount);
@@ -347,6 +357,19 @@ void Advance()
   // until the next slice:
   //        Pokemon Box refuses to boot if the first exception from the audio DMA is received late
   PowerPC::CheckExternalExceptions();
+
+  if (!s_after_events.empty())
+  {
+    std::vector<std::function<void()>> functions;
+    std::swap(functions, s_after_events);
+    for (const auto& function : functions)
+      function();
+  }
+}
+
+void RunAfterEvents(std::function<void()> function)
+{
+  s_after_events.push_back(std::move(function));
 }
 
 void LogPendingEvents()
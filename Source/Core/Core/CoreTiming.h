@@ -17,6 +17,7 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <functional>
 #include <string>
 #include "Common/CommonTypes.h"
 
@@ -85,6 +86,11 @@ void RemoveAllEvents(EventType* event_type);
 void Advance();
 void MoveEvents();
 
+// Runs the function at the end of the current Advance(), once the events that are due have run and
+// the timing state is consistent again, e.g. to save a state from an event. Must be called from
+// the CPU thread.
+void RunAfterEvents(std::function<void()> function);
+
 // Pretend that the main CPU has executed enough cycles to reach the next event.
 void Idle();
 
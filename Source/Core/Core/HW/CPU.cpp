@@ -15,6 +15,7 @@
 #include "Core/Host.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/StageTimers.h"
 
 namespace CPU
 {
@@ -117,7 +118,10 @@ void Run()
       }
 
       // Enter a fast runloop
-      PowerPC::RunLoop();
+      {
+        StageTimers::ScopedTimer stage_timer(StageTimers::Stage::CPUEmulation);
+        PowerPC::RunLoop();
+      }
 
       state_lock.lock();
       s_state_cpu_thread_active = false;
@@ -1276,14 +1276,15 @@ void SetDriveError(DriveError error)
 }
 
 void FinishExecutingCommand(ReplyType reply_type, DIInterruptType interrupt_type, s64 cycles_late,
-                            const std::vector<u8>& data)
+                            u32 bytes_read, const std::vector<u8>& data)
 {
-  // The data parameter contains the requested data iff this was called from DVDThread, and is
-  // empty otherwise. DVDThread is the only source of ReplyType::NoReply and ReplyType::DTK.
+  // bytes_read is the amount of data that DVDThread read, and is 0 otherwise. The data parameter
+  // contains the requested data iff DVDThread read it and didn't copy it straight from the disc
+  // image to emulated RAM. DVDThread is the only source of ReplyType::NoReply and ReplyType::DTK.
 
   u32 transfer_size = 0;
   if (reply_type == ReplyType::NoReply)
-    transfer_size = static_cast<u32>(data.size());
+    transfer_size = bytes_read;
   else if (reply_type == ReplyType::Interrupt || reply_type == ReplyType::IOS)
     transfer_size = s_DILENGTH;
 
@@ -0,0 +1,227 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/HW/DVD/DVDReadAhead.h"
+
+#include <algorithm>
+#include <optional>
+
+#include <fmt/format.h>
+
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+
+#include "DiscIO/Volume.h"
+
+namespace DVDThread
+{
+// Most reads to emulated RAM are 32 KiB.
+constexpr u64 BLOCK_SIZE = 0x8000;
+constexpr size_t MAX_CACHED_BLOCKS = 1024;  // 32 MiB
+
+// How far to read ahead of the last read, sequentially and along the previous trace.
+constexpr u64 SEQUENTIAL_BLOCKS = 4;
+constexpr size_t TRACE_BLOCKS = 16;
+
+constexpr size_t MAX_TRACE_BLOCKS = 16384;
+constexpr u32 TRACE_MAGIC = 0x54445644;  // "DVDT"
+constexpr u32 TRACE_VERSION = 1;
+
+void FaultInMappedData(const u8* data, u64 length)
+{
+  constexpr u64 PAGE_SIZE = 0x1000;
+  const volatile u8* volatile_data = data;
+  for (u64 i = 0; i < length; i += PAGE_SIZE)
+    static_cast<void>(volatile_data[i]);
+  if (length != 0)
+    static_cast<void>(volatile_data[length - 1]);
+}
+
+void ReadAheadCache::SetDisc(const DiscIO::Volume* disc)
+{
+  if (!m_trace_path.empty())
+  {
+    INFO_LOG_FMT(DVDINTERFACE, "Read-ahead: {} hits, {} misses, {} blocks read ahead", m_hits,
+                 m_misses, m_blocks_read_ahead);
+    SaveTrace();
+  }
+
+  m_blocks.clear();
+  m_predicted_blocks.clear();
+  m_trace.clear();
+  m_traced_blocks.clear();
+  m_previous_trace.clear();
+  m_previous_trace_positions.clear();
+  m_previous_trace_cursor = 0;
+  m_hits = 0;
+  m_misses = 0;
+  m_blocks_read_ahead = 0;
+  m_trace_path.clear();
+
+  if (!disc)
+    return;
+
+  const std::string game_id = disc->GetGameID();
+  if (game_id.empty())
+    return;
+
+  m_trace_path = fmt::format("{}{}-{}.dvdtrace", File::GetUserPath(D_CACHE_IDX), game_id,
+                             disc->GetDiscNumber().value_or(0));
+  LoadTrace();
+
+  // Warm the cache with the start of the trace, which is what the game reads while booting.
+  for (size_t i = 0; i < std::min(TRACE_BLOCKS, m_previous_trace.size()); ++i)
+    m_predicted_blocks.push_back(m_previous_trace[i]);
+}
+
+void ReadAheadCache::RecordRead(u64 offset, u32 length, const DiscIO::Partition& partition)
+{
+  if (length == 0)
+    return;
+
+  const u64 first_block = offset / BLOCK_SIZE;
+  const u64 last_block = (offset + length - 1) / BLOCK_SIZE;
+  for (u64 block = first_block; block <= last_block; ++block)
+  {
+    const BlockKey key{partition.offset, block};
+    if (m_trace.size() < MAX_TRACE_BLOCKS && m_traced_blocks.insert(key).second)
+      m_trace.push_back(key);
+  }
+
+  const BlockKey last_key{partition.offset, last_block};
+  const auto it = m_previous_trace_positions.find(last_key);
+  if (it != m_previous_trace_positions.end())
+    m_previous_trace_cursor = it->second + 1;
+
+  m_predicted_blocks.clear();
+  for (u64 i = 1; i <= SEQUENTIAL_BLOCKS; ++i)
+    m_predicted_blocks.emplace_back(partition.offset, last_block + i);
+
+  const size_t trace_end =
+      std::min(m_previous_trace_cursor + TRACE_BLOCKS, m_previous_trace.size());
+  for (size_t i = m_previous_trace_cursor; i < trace_end; ++i)
+    m_predicted_blocks.push_back(m_previous_trace[i]);
+}
+
+bool ReadAheadCache::ReadCached(u64 offset, u32 length, const DiscIO::Partition& partition,
+                                u8* buffer)
+{
+  const u64 end = offset + length;
+  while (offset < end)
+  {
+    const BlockKey key{partition.offset, offset / BLOCK_SIZE};
+    const auto it = m_blocks.find(key);
+    if (it == m_blocks.end() || it->second.data.empty())
+    {
+      ++m_misses;
+      return false;
+    }
+
+    const u64 offset_in_block = offset % BLOCK_SIZE;
+    const u64 bytes_to_copy = std::min(BLOCK_SIZE - offset_in_block, end - offset);
+    std::copy_n(it->second.data.begin() + offset_in_block, bytes_to_copy, buffer);
+    it->second.last_use = ++m_use_counter;
+
+    offset += bytes_to_copy;
+    buffer += bytes_to_copy;
+  }
+
+  ++m_hits;
+  return true;
+}
+
+bool ReadAheadCache::ReadAhead(const DiscIO::Volume& disc)
+{
+  while (!m_predicted_blocks.empty())
+  {
+    const BlockKey key = m_predicted_blocks.front();
+    m_predicted_blocks.pop_front();
+    if (m_blocks.count(key))
+      continue;
+
+    const DiscIO::Partition partition(key.first);
+    const u64 offset = key.second * BLOCK_SIZE;
+    if (const u8* mapped_data = disc.GetMappedData(offset, BLOCK_SIZE, partition))
+    {
+      FaultInMappedData(mapped_data, BLOCK_SIZE);
+      InsertBlock(key, {});
+    }
+    else
+    {
+      // Reads past the end of the disc or partition fail, and are simply not cached.
+      std::vector<u8> data(BLOCK_SIZE);
+      if (!disc.Read(offset, BLOCK_SIZE, data.data(), partition))
+        continue;
+      InsertBlock(key, std::move(data));
+    }
+
+    ++m_blocks_read_ahead;
+    return true;
+  }
+
+  return false;
+}
+
+void ReadAheadCache::InsertBlock(const BlockKey& key, std::vector<u8> data)
+{
+  if (m_blocks.size() >= MAX_CACHED_BLOCKS)
+  {
+    const auto least_recently_used =
+        std::min_element(m_blocks.begin(), m_blocks.end(), [](const auto& a, const auto& b) {
+          return a.second.last_use < b.second.last_use;
+        });
+    m_blocks.erase(least_recently_used);
+  }
+
+  m_blocks[key] = CachedBlock{std::move(data), ++m_use_counter};
+}
+
+void ReadAheadCache::LoadTrace()
+{
+  File::IOFile file(m_trace_path, "rb");
+  if (!file)
+    return;
+
+  u32 magic, version, num_blocks;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) ||
+      !file.ReadArray(&num_blocks, 1) || magic != TRACE_MAGIC || version != TRACE_VERSION ||
+      num_blocks > MAX_TRACE_BLOCKS)
+  {
+    WARN_LOG_FMT(DVDINTERFACE, "Ignoring invalid DVD access trace {}", m_trace_path);
+    return;
+  }
+
+  m_previous_trace.resize(num_blocks);
+  for (BlockKey& key : m_previous_trace)
+  {
+    if (!file.ReadArray(&key.first, 1) || !file.ReadArray(&key.second, 1))
+    {
+      WARN_LOG_FMT(DVDINTERFACE, "Ignoring truncated DVD access trace {}", m_trace_path);
+      m_previous_trace.clear();
+      return;
+    }
+  }
+
+  for (size_t i = 0; i < m_previous_trace.size(); ++i)
+    m_previous_trace_positions.emplace(m_previous_trace[i], i);
+}
+
+void ReadAheadCache::SaveTrace() const
+{
+  // A short session, like booting a game just to quit it, shouldn't replace a longer trace.
+  if (m_trace.size() < m_previous_trace.size())
+    return;
+
+  File::IOFile file(m_trace_path, "wb");
+  const u32 num_blocks = static_cast<u32>(m_trace.size());
+  bool success = file.WriteArray(&TRACE_MAGIC, 1) && file.WriteArray(&TRACE_VERSION, 1) &&
+                 file.WriteArray(&num_blocks, 1);
+  for (const BlockKey& key : m_trace)
+    success = success && file.WriteArray(&key.first, 1) && file.WriteArray(&key.second, 1);
+
+  if (!success)
+    WARN_LOG_FMT(DVDINTERFACE, "Failed to write DVD access trace {}", m_trace_path);
+}
+}  // namespace DVDThread
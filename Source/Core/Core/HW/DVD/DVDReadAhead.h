@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+struct Partition;
+class Volume;
+}  // namespace DiscIO
+
+namespace DVDThread
+{
+// Reads every page of memory mapped data, so that later accesses don't have to wait for the disk.
+void FaultInMappedData(const u8* data, u64 length);
+
+// Reads disc data ahead of the emulated drive, on the DVD thread while it would otherwise be idle.
+// The blocks after each read are predicted to be read next, as well as the blocks that followed
+// it the last time the game was played. That access trace is stored per disc in the cache
+// directory, and replayed from the start at boot to warm the cache.
+//
+// This only hides host I/O latency; when emulated reads complete is decided by DVDInterface, so
+// emulated timing is unaffected. Not thread-safe; only used by the DVD thread, or while it's idle.
+class ReadAheadCache
+{
+public:
+  // Saves the trace of the previous disc, and loads the trace of the new one, if any.
+  void SetDisc(const DiscIO::Volume* disc);
+
+  // Records a read by the emulated software, and predicts the next reads.
+  void RecordRead(u64 offset, u32 length, const DiscIO::Partition& partition);
+
+  // Returns false, leaving the buffer in an unspecified state, if not all the data is cached.
+  bool ReadCached(u64 offset, u32 length, const DiscIO::Partition& partition, u8* buffer);
+
+  // Reads the next predicted block. Returns false if there's nothing left to read ahead.
+  bool ReadAhead(const DiscIO::Volume& disc);
+
+private:
+  // Partition offset and block index.
+  using BlockKey = std::pair<u64, u64>;
+
+  struct CachedBlock
+  {
+    // Empty if the block is memory mapped, in which case reading ahead only faults it in.
+    std::vector<u8> data;
+    u64 last_use;
+  };
+
+  void InsertBlock(const BlockKey& key, std::vector<u8> data);
+  void LoadTrace();
+  void SaveTrace() const;
+
+  std::map<BlockKey, CachedBlock> m_blocks;
+  u64 m_use_counter = 0;
+  std::deque<BlockKey> m_predicted_blocks;
+
+  std::string m_trace_path;
+  // Blocks in the order that they were first read in this session.
+  std::vector<BlockKey> m_trace;
+  std::set<BlockKey> m_traced_blocks;
+  // The trace recorded by the previous session, with where each block first appears in it.
+  std::vector<BlockKey> m_previous_trace;
+  std::map<BlockKey, size_t> m_previous_trace_positions;
+  size_t m_previous_trace_cursor = 0;
+
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+  u64 m_blocks_read_ahead = 0;
+};
+}  // namespace DVDThread
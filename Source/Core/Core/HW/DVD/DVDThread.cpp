@@ -26,6 +26,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDReadAhead.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
@@ -62,13 +63,30 @@ struct ReadRequest
   u64 realtime_done_us;
 };
 
-using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
+struct ReadResult
+{
+  ReadRequest request;
+
+  // Empty if the read failed, or if the data is in mapped_data instead.
+  std::vector<u8> buffer;
+
+  // Reads to emulated RAM from a memory mapped disc image point into the disc image instead of
+  // using buffer, so that FinishRead can copy the data straight into RAM. Only valid until s_disc
+  // changes, and can't be savestated, so CopyMappedResults replaces it with buffer before that.
+  const u8* mapped_data = nullptr;
+
+  bool Succeeded() const { return mapped_data || buffer.size() == request.length; }
+};
+
+// Savestates store results in this format.
+using SavedReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
 static void StartDVDThread();
 static void StopDVDThread();
 
 static void DVDThread();
 static void WaitUntilIdle();
+static void CopyMappedResults();
 
 static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offset, u32 length,
                               const DiscIO::Partition& partition,
@@ -89,6 +107,7 @@ static Common::SPSCQueue<ReadResult, false> s_result_queue;
 static std::map<u64, ReadResult> s_result_map;
 
 static std::unique_ptr<DiscIO::Volume> s_disc;
+static ReadAheadCache s_read_ahead;
 
 void Start()
 {
@@ -98,6 +117,7 @@ void Start()
   s_result_queue_expanded.Reset();
   s_request_queue.Clear();
   s_result_queue.Clear();
+  s_result_map.clear();
 
   // This is reset on every launch for determinism, but it doesn't matter
   // much, because this will never get exposed to the emulated game.
@@ -116,6 +136,7 @@ static void StartDVDThread()
 void Stop()
 {
   StopDVDThread();
+  s_read_ahead.SetDisc(nullptr);
   s_disc.reset();
 }
 
@@ -142,12 +163,16 @@ void DoState(PointerWrap& p)
   // Move all results from s_result_queue to s_result_map because
   // PointerWrap::Do supports std::map but not Common::SPSCQueue.
   // This won't affect the behavior of FinishRead.
-  ReadResult result;
-  while (s_result_queue.Pop(result))
-    s_result_map.emplace(result.first.id, std::move(result));
+  CopyMappedResults();
 
   // Both queues are now empty, so we don't need to savestate them.
-  p.Do(s_result_map);
+  std::map<u64, SavedReadResult> saved_results;
+  for (auto& [id, result] : s_result_map)
+    saved_results.emplace(id, SavedReadResult(result.request, std::move(result.buffer)));
+  p.Do(saved_results);
+  s_result_map.clear();
+  for (auto& [id, saved_result] : saved_results)
+    s_result_map.emplace(id, ReadResult{saved_result.first, std::move(saved_result.second)});
   p.Do(s_next_id);
 
   // s_disc isn't savestated (because it points to files on the
@@ -160,9 +185,14 @@ void DoState(PointerWrap& p)
   if (had_disc != HasDisc())
   {
     if (had_disc)
+    {
       PanicAlertFmtT("An inserted disc was expected but not found.");
+    }
     else
+    {
+      s_read_ahead.SetDisc(nullptr);
       s_disc.reset();
+    }
   }
 
   // TODO: Savestates can be smaller if the buffers of results aren't saved,
@@ -179,7 +209,9 @@ void DoState(PointerWrap& p)
 void SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
+  CopyMappedResults();
   s_disc = std::move(disc);
+  s_read_ahead.SetDisc(s_disc.get());
 }
 
 bool HasDisc()
@@ -256,6 +288,25 @@ void WaitUntilIdle()
   StartDVDThread();
 }
 
+// Moves all results to s_result_map, and copies the data of results that point into s_disc.
+// Must be called after WaitUntilIdle.
+static void CopyMappedResults()
+{
+  ReadResult result;
+  while (s_result_queue.Pop(result))
+    s_result_map.emplace(result.request.id, std::move(result));
+
+  for (auto& [id, map_result] : s_result_map)
+  {
+    if (map_result.mapped_data)
+    {
+      map_result.buffer.assign(map_result.mapped_data,
+                               map_result.mapped_data + map_result.request.length);
+      map_result.mapped_data = nullptr;
+    }
+  }
+}
+
 void StartRead(u64 dvd_offset, u32 length, const DiscIO::Partition& partition,
                DVDInterface::ReplyType reply_type, s64 ticks_until_completion)
 {
@@ -323,16 +374,15 @@ static void FinishRead(u64 id, s64 cycles_late)
       while (!s_result_queue.Pop(result))
         s_result_queue_expanded.Wait();
 
-      if (result.first.id == id)
+      if (result.request.id == id)
         break;
       else
-        s_result_map.emplace(result.first.id, std::move(result));
+        s_result_map.emplace(result.request.id, std::move(result));
     }
   }
   // We have now obtained the right ReadResult.
 
-  const ReadRequest& request = result.first;
-  const std::vector<u8>& buffer = result.second;
+  const ReadRequest& request = result.request;
 
   DEBUG_LOG_FMT(DVDINTERFACE,
                 "Disc has been read. Real time: {} us. "
@@ -344,7 +394,7 @@ static void FinishRead(u64 id, s64 cycles_late)
                     (SystemTimers::GetTicksPerSecond() / 1000000));
 
   DVDInterface::DIInterruptType interrupt;
-  if (buffer.size() != request.length)
+  if (!result.Succeeded())
   {
     PanicAlertFmtT("The disc could not be read (at {0:#x} - {1:#x}).", request.dvd_offset,
                    request.dvd_offset + request.length);
@@ -355,15 +405,20 @@ static void FinishRead(u64 id, s64 cycles_late)
   else
   {
     if (request.copy_to_ram)
-      Memory::CopyToEmu(request.output_address, buffer.data(), request.length);
+    {
+      const u8* data = result.mapped_data ? result.mapped_data : result.buffer.data();
+      Memory::CopyToEmu(request.output_address, data, request.length);
+    }
 
     interrupt = DVDInterface::DIInterruptType::TCINT;
   }
 
   // Notify the emulated software that the command has been executed
-  DVDInterface::FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
+  DVDInterface::FinishExecutingCommand(request.reply_type, interrupt, cycles_late,
+                                       result.Succeeded() ? request.length : 0, result.buffer);
 }
 
+
 static void DVDThread()
 {
   Common::SetCurrentThreadName("DVD thread");
@@ -375,19 +430,56 @@ static void DVDThread()
     if (s_dvd_thread_exiting.IsSet())
       return;
 
-    ReadRequest request;
-    while (s_request_queue.Pop(request))
+    // Only read ahead after handling a request. The CPU thread may be using s_disc if this thread
+    // was just restarted by WaitUntilIdle and woken up by a leftover event.
+    bool handled_request = false;
+    while (true)
     {
-      FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
-
-      std::vector<u8> buffer(request.length);
-      if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
-
-      request.realtime_done_us = Common::Timer::GetTimeUs();
-
-      s_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
-      s_result_queue_expanded.Set();
+      ReadRequest request;
+      while (s_request_queue.Pop(request))
+      {
+        FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
+        s_read_ahead.RecordRead(request.dvd_offset, request.length, request.partition);
+
+        ReadResult result;
+        if (request.copy_to_ram)
+        {
+          result.mapped_data =
+              s_disc->GetMappedData(request.dvd_offset, request.length, request.partition);
+        }
+
+        if (result.mapped_data)
+        {
+          // So that FinishRead doesn't have to wait for the disk when it copies the data.
+          FaultInMappedData(result.mapped_data, request.length);
+        }
+        else
+        {
+          result.buffer.resize(request.length);
+          if (!s_read_ahead.ReadCached(request.dvd_offset, request.length, request.partition,
+                                       result.buffer.data()) &&
+              !s_disc->Read(request.dvd_offset, request.length, result.buffer.data(),
+                            request.partition))
+          {
+            result.buffer.resize(0);
+          }
+        }
+
+        request.realtime_done_us = Common::Timer::GetTimeUs();
+        result.request = std::move(request);
+
+        s_result_queue.Push(std::move(result));
+        s_result_queue_expanded.Set();
+        handled_request = true;
+
+        if (s_dvd_thread_exiting.IsSet())
+          return;
+      }
+
+      // While the emulated drive is busy with the last request, read what's likely to come next.
+      // Check for new requests after every block, so that they never wait for long.
+      if (!handled_request || !s_read_ahead.ReadAhead(*s_disc))
+        break;
 
       if (s_dvd_thread_exiting.IsSet())
         return;
@@ -395,7 +487,7 @@ static void DVDThread()
   }
 }
 
-void ReadFile(std::string& fileName, std::vector<u8>& buf)
+void ReadFile(const std::string& fileName, std::vector<u8>& buf)
 {
   if (HasDisc())
   {
@@ -61,5 +61,5 @@ void StartReadToEmulatedRAM(u32 output_address, u64 dvd_offset, u32 length,
                             const DiscIO::Partition& partition, DVDInterface::ReplyType reply_type,
                             s64 ticks_until_completion);
 
-void ReadFile(std::string& fileName, std::vector<u8>& buf);
+void ReadFile(const std::string& fileName, std::vector<u8>& buf);
 }  // namespace DVDThread
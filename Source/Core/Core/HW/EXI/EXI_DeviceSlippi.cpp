@@ -2028,8 +2028,7 @@ void CEXISlippi::prepareFileLength(u8* payload)
 
   std::string fileName((char*)&payload[0]);
 
-  std::string contents;
-  u32 size = gameFileLoader->LoadFile(fileName, contents);
+  u32 size = (u32)gameFileLoader->LoadFile(fileName).size();
 
   INFO_LOG(SLIPPI, "Getting file size for: %s -> %d", fileName.c_str(), size);
 
@@ -2043,14 +2042,13 @@ void CEXISlippi::prepareFileLoad(u8* payload)
 
   std::string fileName((char*)&payload[0]);
 
-  std::string contents;
-  u32 size = gameFileLoader->LoadFile(fileName, contents);
-  std::vector<u8> buf(contents.begin(), contents.end());
+  std::string_view contents = gameFileLoader->LoadFile(fileName);
+  u32 size = (u32)contents.size();
 
   INFO_LOG(SLIPPI, "Writing file contents: %s -> %d", fileName.c_str(), size);
 
   // Write the contents to output
-  m_read_queue.insert(m_read_queue.end(), buf.begin(), buf.end());
+  m_read_queue.insert(m_read_queue.end(), contents.begin(), contents.end());
 }
 
 void CEXISlippi::logMessageFromGame(u8* payload)
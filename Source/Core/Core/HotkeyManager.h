@@ -177,6 +177,8 @@ enum Hotkey
   HK_UNDO_SAVE_STATE,
   HK_SAVE_STATE_FILE,
   HK_LOAD_STATE_FILE,
+  HK_REWIND_STEP_BACK,
+  HK_REWIND_SEEK_BACK,
 
   // Slippi Playback
   HK_SLIPPI_JUMP_BACK,
@@ -710,6 +710,8 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
       packet >> m_net_settings.m_DeferEFBCopies;
       packet >> m_net_settings.m_EFBAccessTileSize;
       packet >> m_net_settings.m_EFBAccessDeferInvalidation;
+      packet >> m_net_settings.m_EFBAccessPredictiveReadback;
+      packet >> m_net_settings.m_EFBAccessMaxStaleFrames;
       packet >> m_net_settings.m_StrictSettingsSync;
 
       m_initial_rtc = Common::PacketReadU64(packet);
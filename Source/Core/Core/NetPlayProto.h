@@ -76,6 +76,8 @@ struct NetSettings
   bool m_DeferEFBCopies;
   bool m_EFBAccessTileSize;
   bool m_EFBAccessDeferInvalidation;
+  bool m_EFBAccessPredictiveReadback;
+  int m_EFBAccessMaxStaleFrames;
   bool m_StrictSettingsSync;
   bool m_SyncSaveData;
   bool m_SyncCodes;
@@ -1355,6 +1355,8 @@ bool NetPlayServer::StartGame()
   spac << m_settings.m_DeferEFBCopies;
   spac << m_settings.m_EFBAccessTileSize;
   spac << m_settings.m_EFBAccessDeferInvalidation;
+  spac << m_settings.m_EFBAccessPredictiveReadback;
+  spac << m_settings.m_EFBAccessMaxStaleFrames;
   spac << m_settings.m_StrictSettingsSync;
   spac << initial_rtc;
   spac << m_settings.m_SyncSaveData;
@@ -1,5 +1,12 @@
 #include "SlippiGameFileLoader.h"
 
+#include <array>
+#include <cstring>
+#include <random>
+
+#include <fmt/format.h>
+#include <mbedtls/sha1.h>
+
 #include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
@@ -28,41 +35,94 @@ std::string getFilePath(std::string fileName)
   return "";
 }
 
-u32 SlippiGameFileLoader::LoadFile(std::string fileName, std::string& data)
+static bool MapFile(const std::string& path, File::MappedFile* mapping)
 {
-  if (fileCache.count(fileName))
+  File::IOFile file(path, "rb");
+  return file && mapping->Map(file);
+}
+
+bool SlippiGameFileLoader::MapSharedFile(const std::string& contents, CachedFile* file)
+{
+  // Patched files are stored by the hash of their contents, so instances with the same files
+  // end up mapping the same cache file, whichever instance created it.
+  std::array<u8, 20> hash;
+  mbedtls_sha1_ret(reinterpret_cast<const u8*>(contents.data()), contents.size(), hash.data());
+
+  const std::string dir_path = File::GetUserPath(D_CACHE_IDX) + "SlippiGameFiles/";
+  const std::string path = fmt::format("{}{:02x}.bin", dir_path, fmt::join(hash, ""));
+
+  if (!File::Exists(path))
   {
-    data = fileCache[fileName];
-    return (u32)data.size();
+    // Write to a temporary file first, so that other instances never map a partial file. The
+    // name is random because other instances may be writing the same file. If another instance
+    // wins the race to create the file, its copy is used instead.
+    const std::string temp_path = fmt::format("{}.{:08x}.tmp", path, std::random_device()());
+    File::CreateFullPath(dir_path);
+    if (!File::WriteStringToFile(temp_path, contents) || !File::Rename(temp_path, path))
+      File::Delete(temp_path);
   }
 
-  INFO_LOG(SLIPPI, "Loading file: %s", fileName.c_str());
+  if (!MapFile(path, &file->mapping))
+    return false;
 
-  std::string gameFilePath = getFilePath(fileName);
-  if (gameFilePath.empty())
+  // Don't trust a file that something else has changed.
+  if (file->mapping.GetSize() != contents.size() ||
+      std::memcmp(file->mapping.GetData(), contents.data(), contents.size()) != 0)
   {
-    fileCache[fileName] = "";
-    data = "";
-    return 0;
+    WARN_LOG(SLIPPI, "Ignoring modified game file cache entry: %s", path.c_str());
+    file->mapping.Unmap();
+    return false;
   }
 
-  std::string fileContents;
-  File::ReadFileToString(gameFilePath, fileContents);
+  return true;
+}
+
+std::string_view SlippiGameFileLoader::LoadFile(const std::string& fileName)
+{
+  auto it = fileCache.find(fileName);
+  if (it != fileCache.end())
+    return it->second.view;
+
+  INFO_LOG(SLIPPI, "Loading file: %s", fileName.c_str());
+
+  CachedFile& file = fileCache[fileName];
+
+  std::string gameFilePath = getFilePath(fileName);
+  if (gameFilePath.empty())
+    return file.view;
 
   // If the file was a diff file and the game is running, load the main file from ISO and apply
   // patch
   if (gameFilePath.substr(gameFilePath.length() - 5) == ".diff" &&
       Core::GetState() == Core::State::Running)
   {
+    std::string diffContents;
+    File::ReadFileToString(gameFilePath, diffContents);
+
     std::vector<u8> buf;
     INFO_LOG(SLIPPI, "Will process diff");
     DVDThread::ReadFile(fileName, buf);
-    std::string diffContents = fileContents;
-    decoder.Decode((char*)buf.data(), buf.size(), diffContents, &fileContents);
+    decoder.Decode((char*)buf.data(), buf.size(), diffContents, &file.contents);
+
+    if (!file.contents.empty() && MapSharedFile(file.contents, &file))
+      std::string().swap(file.contents);
+  }
+  // Other files are mapped straight from the Sys directory
+  else if (!MapFile(gameFilePath, &file.mapping))
+  {
+    File::ReadFileToString(gameFilePath, file.contents);
+  }
+
+  if (file.mapping.IsMapped())
+  {
+    file.view = std::string_view(reinterpret_cast<const char*>(file.mapping.GetData()),
+                                 file.mapping.GetSize());
+  }
+  else
+  {
+    file.view = file.contents;
   }
 
-  fileCache[fileName] = fileContents;
-  data = fileCache[fileName];
-  INFO_LOG(SLIPPI, "File size: %d", (u32)data.size());
-  return (u32)data.size();
+  INFO_LOG(SLIPPI, "File size: %d", (u32)file.view.size());
+  return file.view;
 }
@@ -2,16 +2,31 @@
 
 #include <open-vcdiff/src/google/vcdecoder.h>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include "Common/CommonTypes.h"
+#include "Common/MappedFile.h"
 
 class SlippiGameFileLoader
 {
 public:
-  u32 LoadFile(std::string fileName, std::string& contents);
+  // The returned view stays valid for as long as the loader exists.
+  std::string_view LoadFile(const std::string& fileName);
 
 protected:
-  std::unordered_map<std::string, std::string> fileCache;
+  struct CachedFile
+  {
+    // Loaded files are memory mapped where possible, so that all instances running on a host
+    // share one copy of them through the page cache. Otherwise the contents are kept in memory.
+    File::MappedFile mapping;
+    std::string contents;
+    std::string_view view;
+  };
+
+  // Maps a file in the shared cache, storing the contents there first if needed.
+  bool MapSharedFile(const std::string& contents, CachedFile* file);
+
+  std::unordered_map<std::string, CachedFile> fileCache;
   open_vcdiff::VCDiffDecoder decoder;
 };
@@ -4,20 +4,30 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <lzo/lzo1x.h>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/Event.h"
 #include "Common/File.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/ScopeGuard.h"
@@ -25,6 +35,7 @@
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -36,6 +47,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/StateCompression.h"
 
 #include "VideoCommon/FrameDump.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -55,10 +67,54 @@ static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
 static unsigned char __LZO_MMODEL out[OUT_LEN];
 
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
+// The sections of the last state that was written, which the next state is expected to match.
+static StateSectionSizes s_last_section_sizes{};
+// Room for the next state to grow before it has to be written again
+constexpr size_t STATE_SIZE_SLACK = 64 * 1024;
+
+// Savestates used to be compressed with LZO, in blocks of IN_LEN bytes that are each preceded by
+// their compressed size. They are now compressed with zstd, in independent chunks, so that they
+// can be compressed and decompressed on several threads. Chunks don't cross the boundaries of
+// sections, so that a section changing size doesn't shift the chunks of the sections after it.
+// This header is followed by the size of each section and the compressed size of each chunk as
+// u32s, and then by the chunks. It starts with an empty LZO block, which older versions reject
+// without reading any further.
+struct CompressedStateHeader
+{
+  u32 empty_lzo_block_size;
+  u32 magic;
+  u32 chunk_size;
+  u32 compression_level;  // Informative only
+  // All zeros if the state was compressed without a dictionary
+  Common::SHA1::Digest dictionary_hash;
+  u32 num_sections;
+  u32 num_chunks;
+};
+static_assert(sizeof(CompressedStateHeader) == 44);
+
+constexpr u32 COMPRESSED_STATE_MAGIC = 0x5354535a;  // "ZSTS"
+
+struct StateDictionaryFileHeader
+{
+  u32 magic;
+  u32 version;
+  u64 size;
+  Common::SHA1::Digest hash;
+  u32 padding;
+};
+static_assert(sizeof(StateDictionaryFileHeader) == 40);
+
+constexpr u32 STATE_DICTIONARY_MAGIC = 0x54434944;  // "DICT"
+constexpr u32 STATE_DICTIONARY_VERSION = 1;
+// Far larger than any state, to reject corrupt dictionary headers
+constexpr u64 MAX_STATE_DICTIONARY_SIZE = 512 * 1024 * 1024;
+
+static std::mutex s_dictionary_lock;
+static std::shared_ptr<const StateDictionary> s_dictionary;
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+// The last state that was saved to a file, which the next one takes unchanged chunks from
+static std::mutex s_last_compressed_state_lock;
+static std::shared_ptr<const CompressedState> s_last_compressed_state;
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
 
@@ -146,8 +202,16 @@ static bool DoStateVersion(PointerWrap& p, std::string* version_created_by)
   return true;
 }
 
-static void DoState(PointerWrap& p)
+// on_section_done is called after each subsystem, so that the parts of the state that have been
+// written can be processed while the rest is being written.
+static void DoState(PointerWrap& p, const std::function<void()>& on_section_done = {})
 {
+  const auto end_section = [&p, &on_section_done](const std::string& name) {
+    p.DoMarker(name);
+    if (on_section_done)
+      on_section_done();
+  };
+
   std::string version_created_by;
   if (!DoStateVersion(p, &version_created_by))
   {
@@ -198,23 +262,66 @@ static void DoState(PointerWrap& p)
   // Begin with video backend, so that it gets a chance to clear its caches and writeback modified
   // things to RAM
   g_video_backend->DoState(p);
-  p.DoMarker("video_backend");
+  end_section("video_backend");
 
   PowerPC::DoState(p);
-  p.DoMarker("PowerPC");
+  end_section("PowerPC");
   // CoreTiming needs to be restored before restoring Hardware because
   // the controller code might need to schedule an event if the controller has changed.
   CoreTiming::DoState(p);
-  p.DoMarker("CoreTiming");
+  end_section("CoreTiming");
   HW::DoState(p);
-  p.DoMarker("HW");
+  end_section("HW");
   if (SConfig::GetInstance().bWii)
     Wiimote::DoState(p);
-  p.DoMarker("Wiimote");
+  end_section("Wiimote");
   Gecko::DoState(p);
-  p.DoMarker("Gecko");
+  end_section("Gecko");
+}
+
+// Returns the size that the next state is expected to need.
+static size_t GetExpectedStateSize()
+{
+  size_t size = STATE_SIZE_SLACK;
+  for (const u32 section_size : s_last_section_sizes)
+    size += section_size;
+  return size;
+}
+
+// Writes the state to a buffer of the given capacity, without measuring it first. Returns the size
+// that the state needs, which is larger than the capacity if it didn't fit, in which case it has
+// to be written again, or 0 if DoState failed. on_section_done is called with the offset at which
+// each section ends.
+static size_t TryWriteState(u8* buffer, size_t capacity,
+                            const std::function<void(size_t)>& on_section_done = {})
+{
+  StateSectionSizes section_sizes{};
+  size_t num_sections = 0;
+  size_t section_start = 0;
+
+  u8* ptr = buffer;
+  PointerWrap p(&ptr, capacity, PointerWrap::MODE_WRITE);
+  DoState(p, [&] {
+    const size_t section_end = static_cast<size_t>(ptr - buffer);
+    if (p.GetMode() != PointerWrap::MODE_WRITE || num_sections == NUM_STATE_SECTIONS)
+      return;
+
+    section_sizes[num_sections++] = static_cast<u32>(section_end - section_start);
+    section_start = section_end;
+    if (on_section_done)
+      on_section_done(section_end);
+  });
+
+  const size_t size = static_cast<size_t>(ptr - buffer);
+  if (p.GetMode() != PointerWrap::MODE_WRITE || num_sections != NUM_STATE_SECTIONS)
+    return size > capacity ? size : 0;
+
+  s_last_section_sizes = section_sizes;
+  return size;
 }
 
+static void ResetRewindHistory();
+
 void LoadFromBuffer(std::vector<u8>& buffer)
 {
   if (NetPlay::IsNetPlayRunning())
@@ -225,9 +332,10 @@ void LoadFromBuffer(std::vector<u8>& buffer)
 
   Core::RunOnCPUThread(
       [&] {
-        u8* ptr = &buffer[0];
-        PointerWrap p(&ptr, PointerWrap::MODE_READ);
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::MODE_READ);
         DoState(p);
+        ResetRewindHistory();
       },
       true);
 }
@@ -236,15 +344,11 @@ void SaveToBuffer(std::vector<u8>& buffer)
 {
   Core::RunOnCPUThread(
       [&] {
-        u8* ptr = nullptr;
-        PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-
-        DoState(p);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
-        ptr = &buffer[0];
-        p.SetMode(PointerWrap::MODE_WRITE);
-        DoState(p);
+        buffer.resize(GetExpectedStateSize());
+        size_t size;
+        while ((size = TryWriteState(buffer.data(), buffer.size())) > buffer.size())
+          buffer.resize(size);
+        buffer.resize(size);
       },
       true);
 }
@@ -296,10 +400,485 @@ static std::map<double, int> GetSavedStates()
   return m;
 }
 
+static std::string GetGameID(const StateHeader& header)
+{
+  return std::string(header.gameID, strnlen(header.gameID, std::size(header.gameID)));
+}
+
+static std::string GetDictionaryPath(const std::string& game_id)
+{
+  return File::GetUserPath(D_STATESAVES_IDX) + game_id + ".dict";
+}
+
+// Returns the dictionary of the game, or nullptr if it doesn't have one.
+static std::shared_ptr<const StateDictionary> GetDictionary(const std::string& game_id)
+{
+  std::lock_guard<std::mutex> lk(s_dictionary_lock);
+  if (s_dictionary && s_dictionary->game_id == game_id)
+    return s_dictionary;
+
+  File::IOFile f(GetDictionaryPath(game_id), "rb");
+  StateDictionaryFileHeader header;
+  if (!f || !f.ReadArray(&header, 1) || header.magic != STATE_DICTIONARY_MAGIC ||
+      header.version != STATE_DICTIONARY_VERSION || header.size > MAX_STATE_DICTIONARY_SIZE)
+  {
+    return nullptr;
+  }
+
+  std::vector<u8> compressed(f.GetSize() - sizeof(header));
+  if (!f.ReadBytes(compressed.data(), compressed.size()))
+    return nullptr;
+
+  auto dictionary = std::make_shared<StateDictionary>();
+  dictionary->game_id = game_id;
+  dictionary->hash = header.hash;
+  dictionary->data.resize(header.size);
+  const size_t result = ZSTD_decompress(dictionary->data.data(), dictionary->data.size(),
+                                        compressed.data(), compressed.size());
+  if (ZSTD_isError(result) || result != header.size)
+    return nullptr;
+
+  s_dictionary = dictionary;
+  return dictionary;
+}
+
+// Returns whether any state of the game in the state directory was compressed with a dictionary.
+static bool HasStatesUsingDictionary(const std::string& game_id)
+{
+  for (const std::string& path : Common::DoFileSearch({File::GetUserPath(D_STATESAVES_IDX)}))
+  {
+    File::IOFile f(path, "rb");
+    StateHeader header;
+    CompressedStateHeader compressed_header;
+    if (f && f.ReadArray(&header, 1) && GetGameID(header) == game_id && header.size != 0 &&
+        f.ReadArray(&compressed_header, 1) && compressed_header.empty_lzo_block_size == 0 &&
+        compressed_header.magic == COMPRESSED_STATE_MAGIC &&
+        compressed_header.dictionary_hash != Common::SHA1::Digest{})
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Stores the given state as the dictionary of the game. Returns nullptr on failure.
+static std::shared_ptr<const StateDictionary> CreateDictionary(const std::string& game_id,
+                                                               const u8* data, size_t size)
+{
+  auto dictionary = std::make_shared<StateDictionary>();
+  dictionary->game_id = game_id;
+  dictionary->hash = Common::SHA1::CalculateDigest(data, size);
+  dictionary->data.assign(data, data + size);
+
+  std::vector<u8> compressed(ZSTD_compressBound(size));
+  const size_t compressed_size =
+      ZSTD_compress(compressed.data(), compressed.size(), data, size, STATE_COMPRESSION_LEVEL);
+  if (ZSTD_isError(compressed_size))
+    return nullptr;
+
+  // States that use the dictionary can't be loaded without it, so write it to a temporary file
+  // first, so that a partially written dictionary never takes its place.
+  const std::string path = GetDictionaryPath(game_id);
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(path);
+  {
+    const StateDictionaryFileHeader header{STATE_DICTIONARY_MAGIC, STATE_DICTIONARY_VERSION, size,
+                                           dictionary->hash, 0};
+    File::IOFile f(temp_path, "wb");
+    if (!f.WriteArray(&header, 1) || !f.WriteBytes(compressed.data(), compressed_size))
+    {
+      f.Close();
+      File::Delete(temp_path);
+      return nullptr;
+    }
+  }
+  if (!File::Rename(temp_path, path))
+  {
+    File::Delete(temp_path);
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lk(s_dictionary_lock);
+  s_dictionary = dictionary;
+  return dictionary;
+}
+
+static bool WriteCompressedState(File::IOFile& f, const CompressedState& state)
+{
+  CompressedStateHeader header{};
+  header.magic = COMPRESSED_STATE_MAGIC;
+  header.chunk_size = STATE_CHUNK_SIZE;
+  header.compression_level = STATE_COMPRESSION_LEVEL;
+  if (state.dictionary)
+    header.dictionary_hash = state.dictionary->hash;
+  header.num_sections = static_cast<u32>(state.section_sizes.size());
+  header.num_chunks = static_cast<u32>(state.chunks.size());
+
+  std::vector<u32> compressed_sizes(state.chunks.size());
+  for (size_t i = 0; i < state.chunks.size(); ++i)
+    compressed_sizes[i] = static_cast<u32>(state.chunks[i].data->size());
+
+  if (!f.WriteArray(&header, 1) ||
+      !f.WriteArray(state.section_sizes.data(), state.section_sizes.size()) ||
+      !f.WriteArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    return false;
+  }
+  for (const CompressedChunk& chunk : state.chunks)
+  {
+    if (!f.WriteBytes(chunk.data->data(), chunk.data->size()))
+      return false;
+  }
+  return true;
+}
+
+// Reads the rest of a compressed state after its header. The dictionary has to be set by the
+// caller. Chunk hashes are not stored, so the chunks can't be reused for the next state.
+static std::unique_ptr<CompressedState> ReadCompressedState(File::IOFile& f,
+                                                            const CompressedStateHeader& header)
+{
+  if (header.chunk_size != STATE_CHUNK_SIZE || header.num_sections != NUM_STATE_SECTIONS)
+    return nullptr;
+
+  auto state = std::make_unique<CompressedState>();
+  if (!f.ReadArray(state->section_sizes.data(), state->section_sizes.size()))
+    return nullptr;
+
+  u64 num_chunks = 0;
+  for (const u32 section_size : state->section_sizes)
+    num_chunks += (u64{section_size} + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE;
+  std::vector<u32> compressed_sizes(header.num_chunks);
+  if (header.num_chunks != num_chunks ||
+      !f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    return nullptr;
+  }
+
+  state->chunks.resize(header.num_chunks);
+  for (size_t i = 0; i < header.num_chunks; ++i)
+  {
+    if (compressed_sizes[i] > ZSTD_compressBound(STATE_CHUNK_SIZE))
+      return nullptr;
+    std::vector<u8> compressed(compressed_sizes[i]);
+    if (!f.ReadBytes(compressed.data(), compressed.size()))
+      return nullptr;
+    state->chunks[i].data = std::make_shared<const std::vector<u8>>(std::move(compressed));
+  }
+  return state;
+}
+
+// Starts compressing a state that is being written, or returns nullptr if that has to wait until
+// the state is complete, because the dictionary of the game isn't loaded yet.
+static std::unique_ptr<StateCompressor> StartStateCompression(const u8* data, size_t capacity)
+{
+  StateHeader header{};
+  SConfig::GetInstance().GetGameID().copy(header.gameID, std::size(header.gameID));
+  const std::string game_id = GetGameID(header);
+
+  std::shared_ptr<const StateDictionary> dictionary;
+  if (!game_id.empty() && Config::Get(Config::MAIN_STATE_COMPRESSION_DICTIONARY))
+  {
+    std::lock_guard<std::mutex> lk(s_dictionary_lock);
+    if (!s_dictionary || s_dictionary->game_id != game_id)
+      return nullptr;
+    dictionary = s_dictionary;
+  }
+
+  std::shared_ptr<const CompressedState> previous;
+  {
+    std::lock_guard<std::mutex> lk(s_last_compressed_state_lock);
+    previous = s_last_compressed_state;
+  }
+
+  return std::make_unique<StateCompressor>(data, capacity, std::move(dictionary),
+                                           std::move(previous));
+}
+
+// How far RewindSeekBack() goes back, which is 10 seconds at 60 frames per second
+constexpr s64 REWIND_SEEK_FRAMES = 600;
+
+// The CPU thread writes the states into a buffer that is reused between captures. The worker
+// thread and the compression threads then compress them while the CPU thread keeps running.
+class RewindBuffer::Impl
+{
+public:
+  explicit Impl(size_t memory_limit)
+      : m_memory_limit(memory_limit), m_history(memory_limit),
+        m_thread(&Impl::ThreadFunction, this)
+  {
+  }
+
+  ~Impl()
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_lock);
+      m_stopped = true;
+      m_condvar.notify_all();
+    }
+    m_thread.join();
+  }
+
+  void Capture(s64 position)
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_lock);
+      if (m_paused || m_capturing)
+        return;
+      m_capturing = true;
+    }
+
+    m_buffer.resize(std::max(m_buffer.size(), GetExpectedStateSize()));
+    size_t size;
+    while ((size = TryWriteState(m_buffer.data(), m_buffer.size())) > m_buffer.size())
+      m_buffer.resize(size);
+
+    std::lock_guard<std::mutex> lk(m_lock);
+    if (size == 0)
+    {
+      m_capturing = false;
+    }
+    else
+    {
+      m_section_sizes = s_last_section_sizes;
+      m_pending_position = position;
+    }
+    m_condvar.notify_all();
+  }
+
+  std::optional<s64> Load(s64 position)
+  {
+    PauseCaptures();
+    std::optional<s64> loaded_position = m_history.Get(position, &m_buffer);
+    if (loaded_position)
+    {
+      bool loaded = false;
+      Core::RunOnCPUThread(
+          [&] {
+            u8* ptr = m_buffer.data();
+            PointerWrap p(&ptr, m_buffer.size(), PointerWrap::MODE_READ);
+            DoState(p);
+            loaded = p.GetMode() == PointerWrap::MODE_READ;
+          },
+          true);
+      if (loaded)
+        m_history.DropAfter(*loaded_position);
+      else
+        loaded_position.reset();
+    }
+    ResumeCaptures();
+    return loaded_position;
+  }
+
+  void Clear()
+  {
+    PauseCaptures();
+    m_history.Clear();
+    ResumeCaptures();
+  }
+
+  void SetMemoryLimit(size_t memory_limit)
+  {
+    std::lock_guard<std::mutex> lk(m_lock);
+    m_memory_limit = memory_limit;
+  }
+
+  size_t GetMemoryUsage() const
+  {
+    std::lock_guard<std::mutex> lk(m_lock);
+    return m_memory_usage;
+  }
+
+private:
+  void ThreadFunction()
+  {
+    Common::SetCurrentThreadName("Rewind thread");
+
+    std::unique_lock<std::mutex> lk(m_lock);
+    while (true)
+    {
+      m_condvar.wait(lk, [this] { return m_stopped || m_pending_position; });
+      if (m_stopped)
+        return;
+
+      const s64 position = *m_pending_position;
+      m_pending_position.reset();
+      m_history.SetMemoryLimit(m_memory_limit);
+      lk.unlock();
+
+      m_history.Add(position, m_buffer.data(), m_section_sizes);
+      const size_t memory_usage = m_history.GetMemoryUsage();
+
+      lk.lock();
+      m_memory_usage = memory_usage;
+      m_capturing = false;
+      m_condvar.notify_all();
+    }
+  }
+
+  // Waits for the capture in progress, and keeps new ones from starting until ResumeCaptures(),
+  // so that the history and the buffer can be accessed without the other threads.
+  void PauseCaptures()
+  {
+    std::unique_lock<std::mutex> lk(m_lock);
+    m_condvar.wait(lk, [this] { return !m_paused; });
+    m_paused = true;
+    m_condvar.wait(lk, [this] { return !m_capturing; });
+  }
+
+  void ResumeCaptures()
+  {
+    std::lock_guard<std::mutex> lk(m_lock);
+    m_memory_usage = m_history.GetMemoryUsage();
+    m_paused = false;
+    m_condvar.notify_all();
+  }
+
+  mutable std::mutex m_lock;
+  std::condition_variable m_condvar;
+  // Set once the CPU thread has written a state, for the worker thread to compress
+  std::optional<s64> m_pending_position;
+  // From the start of a capture on the CPU thread until the worker thread has compressed it
+  bool m_capturing = false;
+  bool m_paused = false;
+  bool m_stopped = false;
+  size_t m_memory_limit;
+  size_t m_memory_usage = 0;
+
+  // Only accessed by the thread that is capturing, or while captures are paused
+  StateHistory m_history;
+  std::vector<u8> m_buffer;
+  StateSectionSizes m_section_sizes{};
+
+  std::thread m_thread;
+};
+
+RewindBuffer::RewindBuffer(size_t memory_limit) : m_impl(std::make_unique<Impl>(memory_limit))
+{
+}
+
+RewindBuffer::~RewindBuffer() = default;
+
+void RewindBuffer::Capture(s64 position)
+{
+  m_impl->Capture(position);
+}
+
+std::optional<s64> RewindBuffer::Load(s64 position)
+{
+  return m_impl->Load(position);
+}
+
+void RewindBuffer::Clear()
+{
+  m_impl->Clear();
+}
+
+void RewindBuffer::SetMemoryLimit(size_t memory_limit)
+{
+  m_impl->SetMemoryLimit(memory_limit);
+}
+
+size_t RewindBuffer::GetMemoryUsage() const
+{
+  return m_impl->GetMemoryUsage();
+}
+
+// The history that the rewind hotkeys go through, which is labelled with frame numbers
+static std::mutex s_rewind_buffer_lock;
+static std::shared_ptr<RewindBuffer> s_rewind_buffer;
+static std::atomic<s64> s_rewind_frame{0};
+
+// The states in the history don't lead up to a state that was loaded from elsewhere.
+static void ResetRewindHistory()
+{
+  std::shared_ptr<RewindBuffer> rewind_buffer;
+  {
+    std::lock_guard<std::mutex> lk(s_rewind_buffer_lock);
+    rewind_buffer = s_rewind_buffer;
+  }
+  if (rewind_buffer)
+    rewind_buffer->Clear();
+  s_rewind_frame = 0;
+}
+
+// Runs at the end of CoreTiming::Advance(), because in the middle of it, the timing state that
+// would be saved is inconsistent.
+static void CaptureRewindState(s64 frame)
+{
+  const size_t memory_limit =
+      static_cast<size_t>(std::max(Config::Get(Config::MAIN_REWIND_MEMORY_LIMIT), 0)) * 1024 *
+      1024;
+  std::shared_ptr<RewindBuffer> rewind_buffer;
+  {
+    std::lock_guard<std::mutex> lk(s_rewind_buffer_lock);
+    if (!s_rewind_buffer)
+      s_rewind_buffer = std::make_shared<RewindBuffer>(memory_limit);
+    else
+      s_rewind_buffer->SetMemoryLimit(memory_limit);
+    rewind_buffer = s_rewind_buffer;
+  }
+  rewind_buffer->Capture(frame);
+}
+
+void OnFrameEnd()
+{
+  const s64 frame = ++s_rewind_frame;
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED) || NetPlay::IsNetPlayRunning())
+  {
+    std::lock_guard<std::mutex> lk(s_rewind_buffer_lock);
+    s_rewind_buffer.reset();
+    return;
+  }
+  if (frame % std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1) != 0)
+    return;
+
+  CoreTiming::RunAfterEvents([frame] { CaptureRewindState(frame); });
+}
+
+static void Rewind(s64 frames)
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return;
+  }
+
+  std::shared_ptr<RewindBuffer> rewind_buffer;
+  {
+    std::lock_guard<std::mutex> lk(s_rewind_buffer_lock);
+    rewind_buffer = s_rewind_buffer;
+  }
+  if (!rewind_buffer || !Core::IsRunningAndStarted())
+    return;
+
+  const s64 current_frame = s_rewind_frame;
+  const std::optional<s64> frame = rewind_buffer->Load(current_frame - frames);
+  if (!frame)
+  {
+    Core::DisplayMessage("No earlier state to rewind to", 2000);
+    return;
+  }
+
+  s_rewind_frame = *frame;
+  Core::DisplayMessage(fmt::format("Rewound {} frames", current_frame - *frame), 2000);
+}
+
+void RewindStepBack()
+{
+  Rewind(std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1));
+}
+
+void RewindSeekBack()
+{
+  Rewind(REWIND_SEEK_FRAMES);
+}
+
 struct CompressAndDumpState_args
 {
   std::vector<u8>* buffer_vector;
   std::mutex* buffer_mutex;
+  StateSectionSizes section_sizes;
+  // Started while the state was being written, if possible
+  std::unique_ptr<StateCompressor> compressor;
   std::string filename;
   bool wait;
 };
@@ -364,40 +943,78 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
+    std::unique_ptr<StateCompressor> compressor = std::move(save_args.compressor);
+    if (!compressor)
     {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
-
-      if ((i + IN_LEN) >= buffer_size)
+      // Without a game ID, states of different games would share a dictionary.
+      const std::string game_id = GetGameID(header);
+      std::shared_ptr<const StateDictionary> dictionary;
+      if (!game_id.empty() && Config::Get(Config::MAIN_STATE_COMPRESSION_DICTIONARY))
       {
-        cur_len = (lzo_uint32)(buffer_size - i);
+        dictionary = GetDictionary(game_id);
+        if (!dictionary && !File::Exists(GetDictionaryPath(game_id)))
+        {
+          // A new dictionary would have a different hash, so the states which need the missing
+          // one could never be loaded again, even if it is restored.
+          if (HasStatesUsingDictionary(game_id))
+          {
+            Core::DisplayMessage(fmt::format("The compression dictionary {} is missing, saving "
+                                             "the state without one",
+                                             GetDictionaryPath(game_id)),
+                                 4000);
+          }
+          else
+          {
+            dictionary = CreateDictionary(game_id, buffer_data, buffer_size);
+          }
+        }
       }
-      else
+
+      std::shared_ptr<const CompressedState> previous;
       {
-        cur_len = IN_LEN;
+        std::lock_guard<std::mutex> state_lock(s_last_compressed_state_lock);
+        previous = s_last_compressed_state;
       }
 
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertFmtT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
+      compressor = std::make_unique<StateCompressor>(buffer_data, buffer_size, dictionary,
+                                                     std::move(previous));
+      size_t section_end = 0;
+      for (const u32 section_size : save_args.section_sizes)
+      {
+        section_end += section_size;
+        compressor->EndSection(section_end);
+      }
+    }
 
-      if (cur_len != IN_LEN)
-        break;
+    std::shared_ptr<const CompressedState> compressed_state = compressor->Finish();
+    compressor.reset();
+    if (!compressed_state || !WriteCompressedState(f, *compressed_state))
+    {
+      Core::DisplayMessage("Could not save state", 2000);
+      return;
+    }
 
-      i += cur_len;
+    if (compressed_state->dictionary)
+    {
+      Core::DisplayMessage(fmt::format("Saved State to {}, which can only be loaded along with {}",
+                                       filename,
+                                       GetDictionaryPath(compressed_state->dictionary->game_id)),
+                           4000);
     }
+    else
+    {
+      Core::DisplayMessage(fmt::format("Saved State to {}", filename), 2000);
+    }
+
+    std::lock_guard<std::mutex> state_lock(s_last_compressed_state_lock);
+    s_last_compressed_state = std::move(compressed_state);
   }
   else  // uncompressed
   {
     f.WriteBytes(buffer_data, buffer_size);
+    Core::DisplayMessage(fmt::format("Saved State to {}", filename), 2000);
   }
 
-  Core::DisplayMessage(fmt::format("Saved State to {}", filename), 2000);
   Host_UpdateMainFrame();
 }
 
@@ -410,33 +1027,45 @@ void SaveAs(const std::string& filename, bool wait)
 
   Core::RunOnCPUThread(
       [&] {
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-        DoState(p);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
+        std::unique_ptr<StateCompressor> compressor;
+        size_t size;
         {
           std::lock_guard<std::mutex> lk(g_cs_current_buffer);
-          g_current_buffer.resize(buffer_size);
-          ptr = &g_current_buffer[0];
-          p.SetMode(PointerWrap::MODE_WRITE);
-          DoState(p);
+          g_current_buffer.resize(GetExpectedStateSize());
+          while (true)
+          {
+            if (g_use_compression)
+              compressor = StartStateCompression(g_current_buffer.data(), g_current_buffer.size());
+
+            size = TryWriteState(g_current_buffer.data(), g_current_buffer.size(),
+                                 [&compressor](size_t section_end) {
+                                   if (compressor)
+                                     compressor->EndSection(section_end);
+                                 });
+            if (size <= g_current_buffer.size())
+              break;
+
+            // The compressor has to be stopped before the buffer is reallocated.
+            compressor.reset();
+            g_current_buffer.resize(size);
+          }
+          g_current_buffer.resize(size);
         }
 
-        if (p.GetMode() == PointerWrap::MODE_WRITE)
+        if (size != 0)
         {
           Core::DisplayMessage("Saving State...", 1000);
 
           CompressAndDumpState_args save_args;
           save_args.buffer_vector = &g_current_buffer;
           save_args.buffer_mutex = &g_cs_current_buffer;
+          save_args.section_sizes = s_last_section_sizes;
+          save_args.compressor = std::move(compressor);
           save_args.filename = filename;
           save_args.wait = wait;
 
           Flush();
-          g_save_thread = std::thread(CompressAndDumpState, save_args);
+          g_save_thread = std::thread(CompressAndDumpState, std::move(save_args));
           g_compressAndDumpStateSyncEvent.Wait();
         }
         else
@@ -517,6 +1146,40 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
+    CompressedStateHeader compressed_header;
+    if (f.ReadArray(&compressed_header, 1) && compressed_header.empty_lzo_block_size == 0 &&
+        compressed_header.magic == COMPRESSED_STATE_MAGIC)
+    {
+      std::shared_ptr<const StateDictionary> dictionary;
+      if (compressed_header.dictionary_hash != Common::SHA1::Digest{})
+      {
+        const std::string game_id = GetGameID(header);
+        dictionary = GetDictionary(game_id);
+        if (!dictionary || dictionary->hash != compressed_header.dictionary_hash)
+        {
+          Core::DisplayMessage(fmt::format("State needs the compression dictionary {}, which is "
+                                           "missing or was replaced",
+                                           GetDictionaryPath(game_id)),
+                               4000);
+          return;
+        }
+      }
+
+      std::unique_ptr<CompressedState> compressed_state = ReadCompressedState(f, compressed_header);
+      if (compressed_state)
+        compressed_state->dictionary = std::move(dictionary);
+      if (!compressed_state || !DecompressState(*compressed_state, buffer.data(), buffer.size()))
+      {
+        Core::DisplayMessage("The savestate could not be decompressed", 4000);
+        return;
+      }
+
+      ret_data.swap(buffer);
+      return;
+    }
+
+    // Older states are compressed with LZO.
+    f.Seek(sizeof(StateHeader), SEEK_SET);
     lzo_uint i = 0;
     while (true)
     {
@@ -593,9 +1256,10 @@ void LoadAs(const std::string& filename)
 
           if (!buffer.empty())
           {
-            u8* ptr = &buffer[0];
-            PointerWrap p(&ptr, PointerWrap::MODE_READ);
+            u8* ptr = buffer.data();
+            PointerWrap p(&ptr, buffer.size(), PointerWrap::MODE_READ);
             DoState(p);
+            ResetRewindHistory();
             loaded = true;
             loadedSuccessfully = (p.GetMode() == PointerWrap::MODE_READ);
           }
@@ -638,6 +1302,8 @@ void Init()
 {
   if (lzo_init() != LZO_E_OK)
     PanicAlertFmtT("Internal LZO Error - lzo_init() failed");
+
+  s_rewind_frame = 0;
 }
 
 void Shutdown()
@@ -656,6 +1322,23 @@ void Shutdown()
     std::lock_guard<std::mutex> lk(g_cs_undo_load_buffer);
     std::vector<u8>().swap(g_undo_load_buffer);
   }
+
+  {
+    std::lock_guard<std::mutex> lk(s_dictionary_lock);
+    s_dictionary.reset();
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(s_last_compressed_state_lock);
+    s_last_compressed_state.reset();
+  }
+  s_last_section_sizes = {};
+
+  {
+    std::lock_guard<std::mutex> lk(s_rewind_buffer_lock);
+    s_rewind_buffer.reset();
+  }
+  s_rewind_frame = 0;
 }
 
 static std::string MakeStateFilename(int number)
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -61,6 +64,46 @@ void UndoLoadState();
 // wait until previously scheduled savestate event (if any) is done
 void Flush();
 
+// A history of states in memory for rewinding, which are labelled with increasing positions chosen
+// by the owner, such as frame numbers. See StateHistory for how the states are stored.
+class RewindBuffer
+{
+public:
+  explicit RewindBuffer(size_t memory_limit);
+  ~RewindBuffer();
+
+  RewindBuffer(const RewindBuffer&) = delete;
+  RewindBuffer& operator=(const RewindBuffer&) = delete;
+
+  // Writes the current state, and compresses it in the background. States with the same or a later
+  // position are dropped when it is added. Nothing is captured while the previous state is still
+  // being compressed, so that the CPU thread never waits for it. Must be called on the CPU thread,
+  // outside of CoreTiming events.
+  void Capture(s64 position);
+
+  // Loads the newest state at or before the given position, and drops the states after it.
+  // Returns the position of the loaded state, or nothing if there is no such state. Must be called
+  // on the host thread, like the other functions that load states.
+  std::optional<s64> Load(s64 position);
+
+  void Clear();
+
+  void SetMemoryLimit(size_t memory_limit);
+  size_t GetMemoryUsage() const;
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+};
+
+// Called by the CPU thread at the end of every frame. Captures a state for the rewind hotkeys
+// when rewinding is enabled, once the current CoreTiming events have run.
+void OnFrameEnd();
+
+// Go back by one rewind interval, or by several seconds. Must be called on the host thread.
+void RewindStepBack();
+void RewindSeekBack();
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
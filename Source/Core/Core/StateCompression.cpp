@@ -0,0 +1,575 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/StateCompression.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <xxhash.h>
+#include <zstd.h>
+
+#include "Common/Thread.h"
+
+namespace State
+{
+constexpr u32 MAX_STATE_COMPRESSION_THREADS = 8;
+constexpr u32 STATE_DICTIONARY_SLACK = 256 * 1024;
+// A new group of the state history is started after this many states.
+constexpr size_t STATE_HISTORY_GROUP_SIZE = 32;
+// Covers the chunk and its range of the dictionary.
+constexpr int STATE_WINDOW_LOG = 22;
+static_assert((1 << STATE_WINDOW_LOG) >= STATE_CHUNK_SIZE * 2 + STATE_DICTIONARY_SLACK * 2);
+// The default hash table of the fast compression levels is too small to keep track of the whole
+// range of the dictionary, which would leave most matches with it unfound.
+constexpr int STATE_HASH_LOG = 20;
+
+// Returns the range of the dictionary that is used for the chunk at chunk_offset.
+static const u8* GetDictionaryRange(const StateDictionary& dictionary, u64 chunk_offset,
+                                    u32 chunk_size, size_t* range_size)
+{
+  const u64 dictionary_size = dictionary.data.size();
+  const u64 start = std::min(chunk_offset - std::min<u64>(chunk_offset, STATE_DICTIONARY_SLACK),
+                             dictionary_size);
+  const u64 end = std::min(chunk_offset + chunk_size + STATE_DICTIONARY_SLACK, dictionary_size);
+  *range_size = static_cast<size_t>(end - start);
+  return dictionary.data.data() + start;
+}
+
+struct CompressionContextDeleter
+{
+  void operator()(ZSTD_CCtx* context) const { ZSTD_freeCCtx(context); }
+};
+
+struct DecompressionContextDeleter
+{
+  void operator()(ZSTD_DCtx* context) const { ZSTD_freeDCtx(context); }
+};
+
+// Runs a function on each chunk of a state on a number of threads. Chunks can be made available
+// gradually, so that they are processed while the rest of the state is still being written.
+class ChunkWorkers
+{
+public:
+  // Gets the index of the calling thread, for per-thread state, and returns false on failure.
+  using Function = std::function<bool(size_t thread_index, size_t chunk)>;
+
+  ChunkWorkers(size_t max_chunks, Function function)
+      : m_function(std::move(function)), m_num_chunks(max_chunks)
+  {
+    for (size_t i = 0; i < GetNumThreads(max_chunks); ++i)
+      m_threads.emplace_back(&ChunkWorkers::ThreadFunction, this, i);
+  }
+
+  ~ChunkWorkers() { Cancel(); }
+
+  ChunkWorkers(const ChunkWorkers&) = delete;
+  ChunkWorkers& operator=(const ChunkWorkers&) = delete;
+
+  static size_t GetNumThreads(size_t max_chunks)
+  {
+    return std::min<size_t>(
+        std::clamp(std::thread::hardware_concurrency(), 1u, MAX_STATE_COMPRESSION_THREADS),
+        max_chunks);
+  }
+
+  // Makes the chunks with an index below count available.
+  void SetAvailableChunks(size_t count)
+  {
+    std::lock_guard<std::mutex> lk(m_lock);
+    m_available_chunks = std::max(m_available_chunks, std::min(count, m_num_chunks));
+    m_condvar.notify_all();
+  }
+
+  // Makes the chunks with an index below num_chunks available, which are all of them, and waits
+  // for them. Returns false if any of them failed.
+  bool Finish(size_t num_chunks)
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_lock);
+      m_num_chunks = std::min(num_chunks, m_num_chunks);
+      m_available_chunks = m_num_chunks;
+      m_condvar.notify_all();
+    }
+    Join();
+    return !m_stopped;
+  }
+
+  void Cancel()
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_lock);
+      m_stopped = true;
+      m_condvar.notify_all();
+    }
+    Join();
+  }
+
+private:
+  void ThreadFunction(size_t thread_index)
+  {
+    Common::SetCurrentThreadName("Savestate compression thread");
+
+    while (true)
+    {
+      size_t chunk;
+      {
+        std::unique_lock<std::mutex> lk(m_lock);
+        m_condvar.wait(lk, [this] {
+          return m_stopped || m_next_chunk >= m_num_chunks || m_next_chunk < m_available_chunks;
+        });
+        if (m_stopped || m_next_chunk >= m_num_chunks)
+          return;
+        chunk = m_next_chunk++;
+      }
+
+      if (!m_function(thread_index, chunk))
+      {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_stopped = true;
+        m_condvar.notify_all();
+      }
+    }
+  }
+
+  void Join()
+  {
+    for (std::thread& thread : m_threads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+  }
+
+  const Function m_function;
+
+  std::mutex m_lock;
+  std::condition_variable m_condvar;
+  size_t m_num_chunks;
+  size_t m_available_chunks = 0;
+  size_t m_next_chunk = 0;
+  bool m_stopped = false;
+
+  std::vector<std::thread> m_threads;
+};
+
+class StateCompressor::Impl
+{
+public:
+  Impl(const u8* data, size_t capacity, std::shared_ptr<const StateDictionary> dictionary,
+       std::shared_ptr<const CompressedState> previous)
+      : m_data(data), m_capacity(capacity), m_dictionary(std::move(dictionary)),
+        m_previous(previous && previous->dictionary == m_dictionary ? std::move(previous) :
+                                                                        nullptr),
+        m_tasks(capacity / STATE_CHUNK_SIZE + NUM_STATE_SECTIONS), m_chunks(m_tasks.size()),
+        m_contexts(ChunkWorkers::GetNumThreads(m_tasks.size())),
+        m_workers(m_tasks.size(), [this](size_t thread_index, size_t chunk) {
+          return CompressChunk(thread_index, chunk);
+        })
+  {
+  }
+
+  void EndSection(size_t end)
+  {
+    if (m_num_sections == NUM_STATE_SECTIONS || end < m_section_start || end > m_capacity)
+    {
+      m_failed = true;
+      return;
+    }
+
+    const size_t section = m_num_sections++;
+    m_section_sizes[section] = static_cast<u32>(end - m_section_start);
+    for (u64 offset = m_section_start; offset < end; offset += STATE_CHUNK_SIZE)
+    {
+      Task& task = m_tasks[m_num_chunks++];
+      task.offset = offset;
+      task.size = static_cast<u32>(std::min<u64>(end - offset, STATE_CHUNK_SIZE));
+      task.previous = FindPreviousChunk(section, (offset - m_section_start) / STATE_CHUNK_SIZE,
+                                        offset, task.size);
+    }
+    m_section_start = end;
+
+    m_workers.SetAvailableChunks(m_num_chunks);
+  }
+
+  std::shared_ptr<const CompressedState> Finish()
+  {
+    if (m_failed || m_num_sections != NUM_STATE_SECTIONS)
+    {
+      m_workers.Cancel();
+      return nullptr;
+    }
+    if (!m_workers.Finish(m_num_chunks))
+      return nullptr;
+
+    auto state = std::make_shared<CompressedState>();
+    state->dictionary = m_dictionary;
+    state->section_sizes = m_section_sizes;
+    state->chunks.assign(std::make_move_iterator(m_chunks.begin()),
+                         std::make_move_iterator(m_chunks.begin() + m_num_chunks));
+    return state;
+  }
+
+private:
+  using Context = std::unique_ptr<ZSTD_CCtx, CompressionContextDeleter>;
+
+  struct Task
+  {
+    u64 offset;
+    u32 size;
+    // The chunk at the same place in the previous state, if it can be reused when unchanged
+    const CompressedChunk* previous;
+  };
+
+  const CompressedChunk* FindPreviousChunk(size_t section, size_t index, u64 offset,
+                                           u32 size) const
+  {
+    if (!m_previous)
+      return nullptr;
+
+    size_t previous_index = index;
+    for (size_t i = 0; i < section; ++i)
+      previous_index += (m_previous->section_sizes[i] + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE;
+
+    const u64 offset_in_section = static_cast<u64>(index) * STATE_CHUNK_SIZE;
+    if (offset_in_section >= m_previous->section_sizes[section] ||
+        std::min<u64>(m_previous->section_sizes[section] - offset_in_section, STATE_CHUNK_SIZE) !=
+            size)
+    {
+      return nullptr;
+    }
+
+    // A chunk is compressed against the range of the dictionary at its offset, so it can't be
+    // reused once an earlier section changing size has moved it.
+    const CompressedChunk& previous = m_previous->chunks[previous_index];
+    if (m_dictionary && previous.offset != offset)
+      return nullptr;
+    return &previous;
+  }
+
+  bool CompressChunk(size_t thread_index, size_t chunk)
+  {
+    const Task& task = m_tasks[chunk];
+    const u8* data = m_data + task.offset;
+    CompressedChunk& result = m_chunks[chunk];
+
+    result.offset = task.offset;
+    result.hash = XXH64(data, task.size, 0);
+    if (task.previous && task.previous->hash == result.hash)
+    {
+      result.data = task.previous->data;
+      return true;
+    }
+
+    Context& context = m_contexts[thread_index];
+    if (!context)
+    {
+      context.reset(ZSTD_createCCtx());
+      if (!context ||
+          ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel,
+                                              STATE_COMPRESSION_LEVEL)) ||
+          ZSTD_isError(
+              ZSTD_CCtx_setParameter(context.get(), ZSTD_c_windowLog, STATE_WINDOW_LOG)) ||
+          ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_hashLog, STATE_HASH_LOG)) ||
+          ZSTD_isError(ZSTD_CCtx_setParameter(context.get(), ZSTD_c_checksumFlag, 1)))
+      {
+        return false;
+      }
+    }
+
+    size_t prefix_size = 0;
+    const u8* prefix =
+        m_dictionary ?
+            GetDictionaryRange(*m_dictionary, task.offset, STATE_CHUNK_SIZE, &prefix_size) :
+            nullptr;
+    if (prefix_size != 0 && ZSTD_isError(ZSTD_CCtx_refPrefix(context.get(), prefix, prefix_size)))
+      return false;
+
+    std::vector<u8> compressed(ZSTD_compressBound(task.size));
+    const size_t compressed_size =
+        ZSTD_compress2(context.get(), compressed.data(), compressed.size(), data, task.size);
+    if (ZSTD_isError(compressed_size))
+      return false;
+    compressed.resize(compressed_size);
+
+    result.data = std::make_shared<const std::vector<u8>>(std::move(compressed));
+    return true;
+  }
+
+  const u8* const m_data;
+  const size_t m_capacity;
+  const std::shared_ptr<const StateDictionary> m_dictionary;
+  const std::shared_ptr<const CompressedState> m_previous;
+
+  // Only accessed by the thread that writes the state
+  StateSectionSizes m_section_sizes{};
+  size_t m_num_sections = 0;
+  u64 m_section_start = 0;
+  size_t m_num_chunks = 0;
+  bool m_failed = false;
+
+  std::vector<Task> m_tasks;
+  std::vector<CompressedChunk> m_chunks;
+  std::vector<Context> m_contexts;
+
+  // Must come last, so that the threads are stopped before the rest is destroyed.
+  ChunkWorkers m_workers;
+};
+
+StateCompressor::StateCompressor(const u8* data, size_t capacity,
+                                 std::shared_ptr<const StateDictionary> dictionary,
+                                 std::shared_ptr<const CompressedState> previous)
+    : m_impl(std::make_unique<Impl>(data, capacity, std::move(dictionary), std::move(previous)))
+{
+}
+
+StateCompressor::~StateCompressor() = default;
+
+void StateCompressor::EndSection(size_t end)
+{
+  m_impl->EndSection(end);
+}
+
+std::shared_ptr<const CompressedState> StateCompressor::Finish()
+{
+  return m_impl->Finish();
+}
+
+bool DecompressState(const CompressedState& state, u8* data, size_t size)
+{
+  struct Task
+  {
+    u64 offset;
+    u32 size;
+  };
+
+  std::vector<Task> tasks;
+  u64 section_start = 0;
+  for (const u32 section_size : state.section_sizes)
+  {
+    const u64 section_end = section_start + section_size;
+    for (u64 offset = section_start; offset < section_end; offset += STATE_CHUNK_SIZE)
+    {
+      const u64 chunk_size = std::min<u64>(section_end - offset, STATE_CHUNK_SIZE);
+      tasks.push_back({offset, static_cast<u32>(chunk_size)});
+    }
+    section_start = section_end;
+  }
+  if (section_start != size || tasks.size() != state.chunks.size())
+    return false;
+
+  using Context = std::unique_ptr<ZSTD_DCtx, DecompressionContextDeleter>;
+  std::vector<Context> contexts(ChunkWorkers::GetNumThreads(tasks.size()));
+
+  ChunkWorkers workers(tasks.size(), [&](size_t thread_index, size_t chunk) {
+    Context& context = contexts[thread_index];
+    if (!context)
+    {
+      context.reset(ZSTD_createDCtx());
+      if (!context)
+        return false;
+    }
+
+    const Task& task = tasks[chunk];
+    size_t prefix_size = 0;
+    const u8* prefix =
+        state.dictionary ?
+            GetDictionaryRange(*state.dictionary, task.offset, STATE_CHUNK_SIZE, &prefix_size) :
+            nullptr;
+    if (prefix_size != 0 && ZSTD_isError(ZSTD_DCtx_refPrefix(context.get(), prefix, prefix_size)))
+      return false;
+
+    const std::vector<u8>& compressed = *state.chunks[chunk].data;
+    const size_t result = ZSTD_decompressDCtx(context.get(), data + task.offset, task.size,
+                                              compressed.data(), compressed.size());
+    return !ZSTD_isError(result) && result == task.size;
+  });
+  return workers.Finish(tasks.size());
+}
+
+
+static size_t GetStateSize(const StateSectionSizes& section_sizes)
+{
+  size_t size = 0;
+  for (const u32 section_size : section_sizes)
+    size += section_size;
+  return size;
+}
+
+StateHistory::StateHistory(size_t memory_limit) : m_memory_limit(memory_limit)
+{
+}
+
+bool StateHistory::Add(s64 position, const u8* data, const StateSectionSizes& section_sizes)
+{
+  DropAfter(position - 1);
+
+  const bool is_keyframe =
+      !m_keyframe || m_force_keyframe || m_groups.back().size() >= STATE_HISTORY_GROUP_SIZE;
+  const Entry* previous_entry = is_keyframe ? nullptr : &m_groups.back().back();
+
+  std::shared_ptr<const CompressedState> previous;
+  if (previous_entry && m_groups.back().size() > 1)
+  {
+    auto previous_state = std::make_shared<CompressedState>();
+    previous_state->dictionary = m_keyframe;
+    previous_state->section_sizes = previous_entry->section_sizes;
+    previous_state->chunks = previous_entry->chunks;
+    previous = std::move(previous_state);
+  }
+
+  const size_t size = GetStateSize(section_sizes);
+  StateCompressor compressor(data, size, is_keyframe ? nullptr : m_keyframe, std::move(previous));
+  size_t section_end = 0;
+  for (const u32 section_size : section_sizes)
+  {
+    section_end += section_size;
+    compressor.EndSection(section_end);
+  }
+  const std::shared_ptr<const CompressedState> state = compressor.Finish();
+  if (!state)
+    return false;
+
+  Entry entry{position, state->section_sizes, state->chunks, 0};
+  for (const CompressedChunk& chunk : entry.chunks)
+  {
+    const auto is_shared = [&chunk](const CompressedChunk& other) {
+      return other.data == chunk.data;
+    };
+    if (!previous_entry ||
+        std::none_of(previous_entry->chunks.begin(), previous_entry->chunks.end(), is_shared))
+    {
+      entry.owned_size += chunk.data->size();
+    }
+  }
+
+  if (is_keyframe)
+  {
+    auto keyframe = std::make_shared<StateDictionary>();
+    keyframe->data.assign(data, data + size);
+    m_groups.emplace_back();
+    m_keyframe = std::move(keyframe);
+  }
+  m_groups.back().push_back(std::move(entry));
+
+  UpdateMemoryUsage();
+  while (m_memory_usage > m_memory_limit && m_groups.size() > 1)
+  {
+    m_groups.pop_front();
+    UpdateMemoryUsage();
+  }
+  // The newest group can only be dropped once the next one has been started.
+  m_force_keyframe = m_memory_usage > m_memory_limit;
+  return true;
+}
+
+std::optional<s64> StateHistory::Get(s64 position, std::vector<u8>* data)
+{
+  const auto group_it =
+      std::find_if(m_groups.rbegin(), m_groups.rend(),
+                   [position](const Group& group) { return group.front().position <= position; });
+  if (group_it == m_groups.rend())
+    return std::nullopt;
+  const Group& group = *group_it;
+  const auto entry_it = std::find_if(group.rbegin(), group.rend(), [position](const Entry& entry) {
+    return entry.position <= position;
+  });
+
+  // Only the first state of the newest group is kept uncompressed.
+  std::shared_ptr<const StateDictionary> keyframe;
+  if (group_it == m_groups.rbegin())
+    keyframe = m_keyframe;
+  else if (m_loaded_keyframe && m_loaded_keyframe_position == group.front().position)
+    keyframe = m_loaded_keyframe;
+  if (!keyframe)
+  {
+    CompressedState state{nullptr, group.front().section_sizes, group.front().chunks};
+    auto decompressed = std::make_shared<StateDictionary>();
+    decompressed->data.resize(GetStateSize(state.section_sizes));
+    if (!DecompressState(state, decompressed->data.data(), decompressed->data.size()))
+      return std::nullopt;
+    keyframe = std::move(decompressed);
+  }
+  m_loaded_keyframe = keyframe;
+  m_loaded_keyframe_position = group.front().position;
+  UpdateMemoryUsage();
+
+  if (entry_it == std::prev(group.rend()))
+  {
+    *data = keyframe->data;
+  }
+  else
+  {
+    CompressedState state{keyframe, entry_it->section_sizes, entry_it->chunks};
+    data->resize(GetStateSize(state.section_sizes));
+    if (!DecompressState(state, data->data(), data->size()))
+      return std::nullopt;
+  }
+  return entry_it->position;
+}
+
+void StateHistory::DropAfter(s64 position)
+{
+  bool dropped_group = false;
+  while (!m_groups.empty() && m_groups.back().back().position > position)
+  {
+    m_groups.back().pop_back();
+    if (m_groups.back().empty())
+    {
+      m_groups.pop_back();
+      dropped_group = true;
+    }
+  }
+
+  if (dropped_group)
+  {
+    // Without the first state of the new newest group, the next state starts a new group.
+    m_keyframe.reset();
+    if (!m_groups.empty() && m_loaded_keyframe &&
+        m_loaded_keyframe_position == m_groups.back().front().position)
+    {
+      m_keyframe = std::move(m_loaded_keyframe);
+    }
+  }
+  m_loaded_keyframe.reset();
+  UpdateMemoryUsage();
+}
+
+void StateHistory::Clear()
+{
+  m_groups.clear();
+  m_keyframe.reset();
+  m_loaded_keyframe.reset();
+  m_force_keyframe = false;
+  m_memory_usage = 0;
+}
+
+void StateHistory::SetMemoryLimit(size_t memory_limit)
+{
+  m_memory_limit = memory_limit;
+}
+
+size_t StateHistory::GetMemoryUsage() const
+{
+  return m_memory_usage;
+}
+
+void StateHistory::UpdateMemoryUsage()
+{
+  m_memory_usage = m_keyframe ? m_keyframe->data.size() : 0;
+  // Unless it belongs to the newest group, the loaded keyframe is a copy of its own.
+  if (m_loaded_keyframe && m_loaded_keyframe != m_keyframe)
+    m_memory_usage += m_loaded_keyframe->data.size();
+  for (const Group& group : m_groups)
+  {
+    for (const Entry& entry : group)
+      m_memory_usage += entry.owned_size;
+  }
+}
+}  // namespace State
@@ -0,0 +1,143 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Compression of savestates in memory, in independent chunks on several threads.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+
+namespace State
+{
+// DoState writes one section per subsystem: the video backend (which also holds the version
+// header), PowerPC, CoreTiming, HW, Wiimote and Gecko.
+constexpr size_t NUM_STATE_SECTIONS = 6;
+using StateSectionSizes = std::array<u32, NUM_STATE_SECTIONS>;
+
+// States are compressed in chunks of this size. Chunks don't cross the boundaries of sections, so
+// that a section changing size doesn't change how the sections after it are split.
+constexpr u32 STATE_CHUNK_SIZE = 1024 * 1024;
+constexpr int STATE_COMPRESSION_LEVEL = 1;
+
+// Savestates of a game have much in common, so when MAIN_STATE_COMPRESSION_DICTIONARY is enabled,
+// every savestate of a game is compressed with the first savestate that was saved for it as a
+// dictionary, which is stored once in the state directory. Each chunk only refers to the same
+// range of the dictionary and some slack around it, which covers the layout shifting when
+// variable-size data changes size between savestates.
+struct StateDictionary
+{
+  std::string game_id;
+  Common::SHA1::Digest hash;
+  std::vector<u8> data;
+};
+
+struct CompressedChunk
+{
+  // Where the chunk starts in the uncompressed state, which selects its range of the dictionary
+  u64 offset;
+  u64 hash;  // XXH64 of the uncompressed data
+  std::shared_ptr<const std::vector<u8>> data;
+};
+
+// A compressed state in memory. Chunks that didn't change are shared with the state that was
+// compressed before it.
+struct CompressedState
+{
+  std::shared_ptr<const StateDictionary> dictionary;
+  StateSectionSizes section_sizes;
+  std::vector<CompressedChunk> chunks;
+};
+
+// Compresses a state on a number of threads. Each section is compressed as soon as it has been
+// written, while the rest of the state is still being written. Chunks that are identical to the
+// same chunk of the previous state, and that start at the same offset, are taken from it instead
+// of being compressed again.
+class StateCompressor
+{
+public:
+  // capacity is the size of the buffer that the state is being written to.
+  StateCompressor(const u8* data, size_t capacity,
+                  std::shared_ptr<const StateDictionary> dictionary,
+                  std::shared_ptr<const CompressedState> previous);
+  ~StateCompressor();
+
+  StateCompressor(const StateCompressor&) = delete;
+  StateCompressor& operator=(const StateCompressor&) = delete;
+
+  // Tells the compressor that the next section has been written, up to the given offset.
+  void EndSection(size_t end);
+
+  // Waits for the compression to finish. Returns nullptr on failure.
+  std::shared_ptr<const CompressedState> Finish();
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+};
+
+// Decompresses a state on a number of threads.
+bool DecompressState(const CompressedState& state, u8* data, size_t size);
+
+// A history of states in memory, which are labelled with increasing positions, such as frame
+// numbers. States are compressed in groups. The first state of each group is compressed on its
+// own, and the other states are compressed with it as a dictionary and take the chunks that didn't
+// change from the state before them. When the history uses more memory than its limit, the oldest
+// groups are dropped. Not thread-safe.
+class StateHistory
+{
+public:
+  explicit StateHistory(size_t memory_limit);
+
+  // Compresses a state and adds it to the history, after dropping the states with the same or a
+  // later position. Returns false if the state couldn't be compressed.
+  bool Add(s64 position, const u8* data, const StateSectionSizes& section_sizes);
+
+  // Decompresses the newest state at or before the given position. Returns its position, or
+  // nothing if there is no such state.
+  std::optional<s64> Get(s64 position, std::vector<u8>* data);
+
+  // Drops the states after the given position.
+  void DropAfter(s64 position);
+
+  void Clear();
+
+  // The new limit applies from the next call to Add().
+  void SetMemoryLimit(size_t memory_limit);
+  size_t GetMemoryUsage() const;
+
+private:
+  struct Entry
+  {
+    s64 position;
+    StateSectionSizes section_sizes;
+    std::vector<CompressedChunk> chunks;
+    // The compressed size of the chunks that aren't shared with the entry before it
+    size_t owned_size;
+  };
+
+  // Starts with the entry that is compressed on its own
+  using Group = std::vector<Entry>;
+
+  void UpdateMemoryUsage();
+
+  std::deque<Group> m_groups;
+  // The uncompressed first state of the newest group
+  std::shared_ptr<const StateDictionary> m_keyframe;
+  // The first state of the group that Get() last decompressed, for DropAfter() to keep
+  std::shared_ptr<const StateDictionary> m_loaded_keyframe;
+  s64 m_loaded_keyframe_position = 0;
+  bool m_force_keyframe = false;
+  size_t m_memory_limit;
+  size_t m_memory_usage = 0;
+};
+}  // namespace State
@@ -62,6 +62,10 @@ public:
 
   // NOT thread-safe - can't call this from multiple threads.
   virtual bool Read(u64 offset, u64 size, u8* out_ptr) = 0;
+
+  // Returns a pointer to the data if the whole range is memory mapped, or nullptr otherwise.
+  // The pointer stays valid for as long as the blob reader exists. Same thread-safety as Read.
+  virtual const u8* GetMappedData(u64 offset, u64 size) const { return nullptr; }
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset)
   {
@@ -109,9 +109,16 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
 
     if (std::holds_alternative<std::string>(m_content_source))
     {
-      File::IOFile file(std::get<std::string>(m_content_source), "rb");
-      if (!file.Seek(offset_in_content, SEEK_SET) || !file.ReadBytes(*buffer, bytes_to_read))
-        return false;
+      if (const u8* data = GetMappedFileData(offset_in_content, bytes_to_read))
+      {
+        std::copy(data, data + bytes_to_read, *buffer);
+      }
+      else
+      {
+        File::IOFile file(std::get<std::string>(m_content_source), "rb");
+        if (!file.Seek(offset_in_content, SEEK_SET) || !file.ReadBytes(*buffer, bytes_to_read))
+          return false;
+      }
     }
     else if (std::holds_alternative<const u8*>(m_content_source))
     {
@@ -137,6 +144,31 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
   return true;
 }
 
+const u8* DiscContent::GetMappedData(u64 offset, u64 length) const
+{
+  if (offset < m_offset || offset - m_offset > m_size || length > m_size - (offset - m_offset))
+    return nullptr;
+
+  const u64 offset_in_content = offset - m_offset;
+  if (std::holds_alternative<std::string>(m_content_source))
+    return GetMappedFileData(offset_in_content, length);
+  if (std::holds_alternative<const u8*>(m_content_source))
+    return std::get<const u8*>(m_content_source) + offset_in_content;
+  return nullptr;
+}
+
+const u8* DiscContent::GetMappedFileData(u64 offset_in_content, u64 length) const
+{
+  if (!m_mapped_file)
+  {
+    m_mapped_file = std::make_shared<File::MappedFile>();
+    File::IOFile file(std::get<std::string>(m_content_source), "rb");
+    m_mapped_file->Map(file);
+  }
+
+  return m_mapped_file->GetData(offset_in_content, length);
+}
+
 void DiscContentContainer::Add(u64 offset, u64 size, const std::string& path)
 {
   if (size != 0)
@@ -192,6 +224,15 @@ bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer) const
   return true;
 }
 
+const u8* DiscContentContainer::GetMappedData(u64 offset, u64 length) const
+{
+  const auto it = m_contents.upper_bound(DiscContent(offset));
+  if (it == m_contents.end())
+    return nullptr;
+
+  return it->GetMappedData(offset, length);
+}
+
 static std::optional<PartitionType> ParsePartitionDirectoryName(const std::string& name)
 {
   if (name.size() < 2)
@@ -405,6 +446,15 @@ bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
       .Read(offset, length, buffer);
 }
 
+const u8* DirectoryBlobReader::GetMappedData(u64 offset, u64 length) const
+{
+  if (offset + length > m_data_size)
+    return nullptr;
+
+  return (m_is_wii ? m_nonpartition_contents : m_gamecube_pseudopartition.GetContents())
+      .GetMappedData(offset, length);
+}
+
 const DirectoryBlobPartition* DirectoryBlobReader::GetPartition(u64 offset, u64 size,
                                                                 u64 partition_data_offset) const
 {
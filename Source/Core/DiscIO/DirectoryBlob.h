@@ -16,6 +16,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/WiiEncryptionCache.h"
 
@@ -54,6 +55,8 @@ public:
   u64 GetEndOffset() const;
   u64 GetSize() const;
   bool Read(u64* offset, u64* length, u8** buffer) const;
+  // Returns nullptr if the range isn't entirely inside this content, or if it's a partition.
+  const u8* GetMappedData(u64 offset, u64 length) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
   bool operator!=(const DiscContent& other) const { return !(*this == other); }
@@ -63,9 +66,14 @@ public:
   bool operator>=(const DiscContent& other) const { return !(*this > other); }
 
 private:
+  // Maps the file on first use. Returns nullptr if the range can't be mapped.
+  const u8* GetMappedFileData(u64 offset_in_content, u64 length) const;
+
   u64 m_offset;
   u64 m_size = 0;
   ContentSource m_content_source;
+  // Shared so that DiscContent stays copyable. Stays unmapped if mapping the file failed.
+  mutable std::shared_ptr<File::MappedFile> m_mapped_file;
 };
 
 class DiscContentContainer
@@ -83,6 +91,7 @@ public:
   u64 CheckSizeAndAdd(u64 offset, u64 max_size, const std::string& path);
 
   bool Read(u64 offset, u64 length, u8* buffer) const;
+  const u8* GetMappedData(u64 offset, u64 length) const;
 
 private:
   std::set<DiscContent> m_contents;
@@ -157,6 +166,7 @@ public:
   DirectoryBlobReader& operator=(DirectoryBlobReader&&) = default;
 
   bool Read(u64 offset, u64 length, u8* buffer) override;
+  const u8* GetMappedData(u64 offset, u64 length) const override;
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
   bool ReadWiiDecrypted(u64 offset, u64 size, u8* buffer, u64 partition_data_offset) override;
 
@@ -18,6 +18,9 @@ namespace DiscIO
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+
+  // Falls back to reading through m_file if the file can't be mapped.
+  m_mapped_file.Map(m_file);
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -30,6 +33,16 @@ std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapped_file.IsMapped())
+  {
+    const u8* data = m_mapped_file.GetData(offset, nbytes);
+    if (!data)
+      return false;
+
+    std::copy(data, data + nbytes, out_ptr);
+    return true;
+  }
+
   if (m_file.Seek(offset, SEEK_SET) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -41,6 +54,11 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   }
 }
 
+const u8* PlainFileReader::GetMappedData(u64 offset, u64 size) const
+{
+  return m_mapped_file.GetData(offset, size);
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, CompressCB callback)
 {
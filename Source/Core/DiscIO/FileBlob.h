@@ -10,6 +10,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -30,11 +31,14 @@ public:
   std::string GetCompressionMethod() const override { return {}; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  const u8* GetMappedData(u64 offset, u64 size) const override;
 
 private:
   PlainFileReader(File::IOFile file);
 
   File::IOFile m_file;
+  // Reads go through the mapping if mapping the file succeeded, and through m_file otherwise.
+  File::MappedFile m_mapped_file;
   s64 m_size;
 };
 
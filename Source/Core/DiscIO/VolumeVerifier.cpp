@@ -13,13 +13,12 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
-#include <mbedtls/sha1.h>
 #include <pugixml.hpp>
 #include <unzip.h>
-#include <zlib.h>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -27,6 +26,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/HttpRequest.h"
 #include "Common/Logging/Log.h"
 #include "Common/MinizipUtil.h"
@@ -364,7 +364,10 @@ constexpr u64 SL_DVD_R_SIZE = 4707319808;  // Wii RVT-R
 constexpr u64 DL_DVD_SIZE = 8511160320;    // Wii retail
 constexpr u64 DL_DVD_R_SIZE = 8543666176;  // Wii RVT-R
 
-constexpr u64 BLOCK_SIZE = 0x20000;
+// How much data Process reads at once. Blocks of Wii discs are checked right from these chunks, so
+// this is a multiple of the block size.
+constexpr u64 BLOCK_SIZE = 0x200000;
+static_assert(BLOCK_SIZE % VolumeWii::BLOCK_TOTAL_SIZE == 0);
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -384,6 +387,7 @@ void VolumeVerifier::Start()
 {
   ASSERT(!m_started);
   m_started = true;
+  m_start_time = std::chrono::steady_clock::now();
 
   if (m_redump_verification)
     m_redump_verifier.Start(m_volume);
@@ -1086,23 +1090,32 @@ void VolumeVerifier::SetUpHashing()
   std::sort(m_blocks.begin(), m_blocks.end(),
             [](const BlockToVerify& b1, const BlockToVerify& b2) { return b1.offset < b2.offset; });
 
-  if (m_hashes_to_calculate.crc32)
-    m_crc32_context = crc32(0, nullptr, 0);
-
   if (m_hashes_to_calculate.md5)
   {
     mbedtls_md5_init(&m_md5_context);
     mbedtls_md5_starts_ret(&m_md5_context);
   }
+}
 
-  if (m_hashes_to_calculate.sha1)
+void VolumeVerifier::StartBlockWorkers()
+{
+  const u32 num_workers = std::max(std::thread::hardware_concurrency(), 1u);
+  for (u32 i = 0; i < num_workers; ++i)
   {
-    mbedtls_sha1_init(&m_sha1_context);
-    mbedtls_sha1_starts_ret(&m_sha1_context);
+    auto worker = std::make_unique<Common::WorkQueueThread<BlockRange>>();
+    worker->Reset([this](BlockRange range) {
+      CheckBlocks(range.first_block, range.end_block, range.data_offset, range.data_size,
+                  range.read_succeeded);
+
+      std::lock_guard lk(m_block_tasks_mutex);
+      if (--m_pending_block_tasks == 0)
+        m_block_tasks_done.notify_all();
+    });
+    m_block_workers.push_back(std::move(worker));
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
   if (m_crc32_future.valid())
     m_crc32_future.wait();
@@ -1112,24 +1125,67 @@ void VolumeVerifier::WaitForAsyncOperations() const
     m_sha1_future.wait();
   if (m_content_future.valid())
     m_content_future.wait();
-  if (m_block_future.valid())
-    m_block_future.wait();
+
+  std::unique_lock lk(m_block_tasks_mutex);
+  m_block_tasks_done.wait(lk, [this] { return m_pending_block_tasks == 0; });
 }
 
 bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  m_read_buffer.resize(bytes_to_read);
   {
     std::lock_guard lk(m_volume_mutex);
-    if (!m_volume.Read(m_progress, bytes_to_read, data.data(), PARTITION_NONE))
+    if (!m_volume.Read(m_progress, bytes_to_read, m_read_buffer.data(), PARTITION_NONE))
       return false;
   }
 
   WaitForAsyncOperations();
-  m_data = std::move(data);
+  std::swap(m_data, m_read_buffer);
   return true;
 }
 
+void VolumeVerifier::CheckBlocks(size_t first_block, size_t end_block, u64 data_offset,
+                                 u64 data_size, bool read_succeeded)
+{
+  for (size_t block_index = first_block; block_index < end_block; ++block_index)
+  {
+    const BlockToVerify& block = m_blocks[block_index];
+
+    bool success;
+    if (read_succeeded && block.offset >= data_offset &&
+        block.offset + VolumeWii::BLOCK_TOTAL_SIZE <= data_offset + data_size)
+    {
+      success = m_volume.CheckBlockIntegrity(
+          block.block_index, m_data.data() + (block.offset - data_offset), block.partition);
+    }
+    else
+    {
+      std::lock_guard lk(m_volume_mutex);
+      success = m_volume.CheckBlockIntegrity(block.block_index, block.partition);
+    }
+
+    std::lock_guard lk(m_block_results_mutex);
+    if (success)
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block.offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block.offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block.offset);
+        m_unused_block_errors[block.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block.offset);
+        m_block_errors[block.partition]++;
+      }
+    }
+  }
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1142,6 +1198,7 @@ void VolumeVerifier::Process()
   bool content_read = false;
   bool block_read = false;
   u64 bytes_to_read = BLOCK_SIZE;
+  size_t end_block_index = m_block_index;
   if (m_content_index < m_content_offsets.size() &&
       m_content_offsets[m_content_index] == m_progress)
   {
@@ -1156,7 +1213,17 @@ void VolumeVerifier::Process()
   }
   else if (m_block_index < m_blocks.size() && m_blocks[m_block_index].offset == m_progress)
   {
-    bytes_to_read = VolumeWii::BLOCK_TOTAL_SIZE;
+    // Read as many whole blocks as fit in the chunk, so that they can be checked from it.
+    while (end_block_index < m_blocks.size() &&
+           m_blocks[end_block_index].offset + VolumeWii::BLOCK_TOTAL_SIZE <=
+               m_progress + bytes_to_read &&
+           (end_block_index == m_block_index ||
+            m_blocks[end_block_index].offset ==
+                m_blocks[end_block_index - 1].offset + VolumeWii::BLOCK_TOTAL_SIZE))
+    {
+      end_block_index++;
+    }
+    bytes_to_read = m_blocks[end_block_index - 1].offset + VolumeWii::BLOCK_TOTAL_SIZE - m_progress;
     block_read = true;
   }
   else if (m_block_index < m_blocks.size() && m_blocks[m_block_index].offset > m_progress)
@@ -1181,9 +1248,7 @@ void VolumeVerifier::Process()
     if (m_hashes_to_calculate.crc32)
     {
       m_crc32_future = std::async(std::launch::async, [this] {
-        // It would be nice to use crc32_z here instead of crc32, but it isn't available on Android
-        m_crc32_context =
-            crc32(m_crc32_context, m_data.data(), static_cast<unsigned int>(m_data.size()));
+        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(), m_data.size());
       });
     }
 
@@ -1196,9 +1261,8 @@ void VolumeVerifier::Process()
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this] {
-        mbedtls_sha1_update_ret(&m_sha1_context, m_data.data(), m_data.size());
-      });
+      m_sha1_future = std::async(std::launch::async,
+                                 [this] { m_sha1_context.Update(m_data.data(), m_data.size()); });
     }
   }
 
@@ -1214,58 +1278,35 @@ void VolumeVerifier::Process()
     m_content_index++;
   }
 
-  if (m_block_index < m_blocks.size() &&
-      m_blocks[m_block_index].offset < m_progress + bytes_to_read)
+  // Blocks that overlap the chunk without being in it, if any, are read separately by CheckBlocks.
+  while (end_block_index < m_blocks.size() &&
+         m_blocks[end_block_index].offset < m_progress + bytes_to_read)
   {
-    m_block_future = std::async(
-        std::launch::async,
-        [this, read_succeeded, bytes_to_read](size_t block_index, u64 progress) {
-          while (block_index < m_blocks.size() &&
-                 m_blocks[block_index].offset < progress + bytes_to_read)
-          {
-            bool success;
-            if (m_blocks[block_index].offset == progress)
-            {
-              success = read_succeeded &&
-                        m_volume.CheckBlockIntegrity(m_blocks[block_index].block_index, m_data,
-                                                     m_blocks[block_index].partition);
-            }
-            else
-            {
-              std::lock_guard lk(m_volume_mutex);
-              success = m_volume.CheckBlockIntegrity(m_blocks[block_index].block_index,
-                                                     m_blocks[block_index].partition);
-            }
-
-            const u64 offset = m_blocks[block_index].offset;
-            if (success)
-            {
-              m_biggest_verified_offset =
-                  std::max(m_biggest_verified_offset, offset + VolumeWii::BLOCK_TOTAL_SIZE);
-            }
-            else
-            {
-              if (m_scrubber.CanBlockBeScrubbed(offset))
-              {
-                WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", offset);
-                m_unused_block_errors[m_blocks[block_index].partition]++;
-              }
-              else
-              {
-                WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", offset);
-                m_block_errors[m_blocks[block_index].partition]++;
-              }
-            }
-            block_index++;
-          }
-        },
-        m_block_index, m_progress);
+    end_block_index++;
+  }
+
+  if (end_block_index != m_block_index)
+  {
+    // Decrypting and hashing a block takes longer than reading it, so the blocks of a chunk are
+    // split between several threads.
+    if (m_block_workers.empty())
+      StartBlockWorkers();
 
-    while (m_block_index < m_blocks.size() &&
-           m_blocks[m_block_index].offset < m_progress + bytes_to_read)
+    const size_t num_blocks = end_block_index - m_block_index;
+    const size_t num_tasks = std::min(m_block_workers.size(), num_blocks);
     {
-      m_block_index++;
+      std::lock_guard lk(m_block_tasks_mutex);
+      m_pending_block_tasks += num_tasks;
     }
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+      const size_t first_block = m_block_index + num_blocks * i / num_tasks;
+      const size_t end_block = m_block_index + num_blocks * (i + 1) / num_tasks;
+      m_block_workers[i]->EmplaceItem(
+          BlockRange{first_block, end_block, m_progress, bytes_to_read, read_succeeded});
+    }
+
+    m_block_index = end_block_index;
   }
 
   m_progress += bytes_to_read;
@@ -1289,6 +1330,11 @@ void VolumeVerifier::Finish()
 
   WaitForAsyncOperations();
 
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start_time;
+  NOTICE_LOG_FMT(DISCIO, "Verified {} MiB in {:.1f} s ({:.0f} MB/s, SHA-1 using {})",
+                 m_progress / (1024 * 1024), elapsed.count(), m_progress / elapsed.count() / 1e6,
+                 Common::SHA1::GetImplementationName());
+
   if (m_calculating_any_hash)
   {
     if (m_hashes_to_calculate.crc32)
@@ -1307,8 +1353,8 @@ void VolumeVerifier::Finish()
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_result.hashes.sha1 = std::vector<u8>(20);
-      mbedtls_sha1_finish_ret(&m_sha1_context, m_result.hashes.sha1.data());
+      const Common::SHA1::Digest sha1 = m_sha1_context.Finish();
+      m_result.hashes.sha1 = std::vector<u8>(sha1.begin(), sha1.end());
     }
   }
 
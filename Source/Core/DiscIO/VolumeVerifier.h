@@ -4,17 +4,21 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <future>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include <mbedtls/md5.h>
-#include <mbedtls/sha1.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -145,6 +149,15 @@ private:
     u64 block_index;
   };
 
+  struct BlockRange
+  {
+    size_t first_block;
+    size_t end_block;
+    u64 data_offset;
+    u64 data_size;
+    bool read_succeeded;
+  };
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -159,8 +172,11 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
+  void StartBlockWorkers();
+  void WaitForAsyncOperations();
   bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void CheckBlocks(size_t first_block, size_t end_block, u64 data_offset, u64 data_size,
+                   bool read_succeeded);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -177,17 +193,19 @@ private:
 
   Hashes<bool> m_hashes_to_calculate{};
   bool m_calculating_any_hash = false;
-  unsigned long m_crc32_context = 0;
+  u32 m_crc32_context = 0;
   mbedtls_md5_context m_md5_context;
-  mbedtls_sha1_context m_sha1_context;
+  Common::SHA1::Context m_sha1_context;
 
+  // The chunk that the async operations work on. The next chunk is read into m_read_buffer in the
+  // meantime, and then the buffers are swapped.
   std::vector<u8> m_data;
+  std::vector<u8> m_read_buffer;
   std::mutex m_volume_mutex;
   std::future<void> m_crc32_future;
   std::future<void> m_md5_future;
   std::future<void> m_sha1_future;
   std::future<void> m_content_future;
-  std::future<void> m_block_future;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -195,6 +213,9 @@ private:
   u16 m_content_index = 0;
   std::vector<BlockToVerify> m_blocks;
   size_t m_block_index = 0;  // Index in m_blocks, not index in a specific partition
+  // Guards m_block_errors, m_unused_block_errors and m_biggest_verified_offset, which the block
+  // checks update from several threads.
+  std::mutex m_block_results_mutex;
   std::map<Partition, size_t> m_block_errors;
   std::map<Partition, size_t> m_unused_block_errors;
 
@@ -205,6 +226,15 @@ private:
   bool m_done = false;
   u64 m_progress = 0;
   u64 m_max_progress = 0;
+  std::chrono::steady_clock::time_point m_start_time;
+
+  // Check the blocks of each chunk in parallel. They are started for the first chunk with blocks
+  // and kept for the rest of the run. Declared last, so that the workers finish their queued
+  // checks before the state that the checks use is destroyed.
+  std::mutex m_block_tasks_mutex;
+  std::condition_variable m_block_tasks_done;
+  size_t m_pending_block_tasks = 0;
+  std::vector<std::unique_ptr<Common::WorkQueueThread<BlockRange>>> m_block_workers;
 };
 
 }  // namespace DiscIO
@@ -6,12 +6,14 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -41,6 +43,13 @@
 
 namespace DiscIO
 {
+// Upper bound for the decompressed data kept in the chunk cache of a reader.
+constexpr u64 MAX_CHUNK_CACHE_SIZE = 64 * 1024 * 1024;
+constexpr size_t MIN_CACHED_CHUNKS = 4;
+constexpr size_t MAX_CACHED_CHUNKS = 64;
+
+constexpr u32 MAX_PREFETCH_WORKERS = 4;
+
 static void PushBack(std::vector<u8>* vector, const u8* begin, const u8* end)
 {
   const size_t offset_in_vector = vector->size();
@@ -77,13 +86,29 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_encryption_cache(this)
+    : m_path(path), m_file(std::move(file)), m_encryption_cache(this)
 {
   m_valid = Initialize(path);
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  for (std::unique_ptr<PrefetchWorker>& worker : m_prefetch_workers)
+    worker->thread.Cancel();
+
+  const ChunkCacheStatistics statistics = GetChunkCacheStatistics();
+  if (statistics.hits + statistics.misses != 0)
+  {
+    INFO_LOG_FMT(DISCIO,
+                 "Chunk cache for {}: {} hits, {} misses, {} prefetched, {} bytes decompressed in "
+                 "{} ms",
+                 m_path, statistics.hits, statistics.misses, statistics.prefetched,
+                 statistics.bytes_decompressed,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(statistics.decompress_time)
+                     .count());
+  }
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -149,6 +174,9 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  m_max_cached_chunks = std::clamp<size_t>(MAX_CHUNK_CACHE_SIZE / std::max<u32>(chunk_size, 1),
+                                           MIN_CACHED_CHUNKS, MAX_CACHED_CHUNKS);
+
   const u32 compression_type = Common::swap32(m_header_2.compression_type);
   m_compression_type = static_cast<WIARVZCompressionType>(compression_type);
   if (m_compression_type > (RVZ ? WIARVZCompressionType::Zstd : WIARVZCompressionType::LZMA2) ||
@@ -282,6 +310,21 @@ std::unique_ptr<WIARVZFileReader<RVZ>> WIARVZFileReader<RVZ>::Create(File::IOFil
   return blob->m_valid ? std::move(blob) : nullptr;
 }
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkCacheStatistics
+WIARVZFileReader<RVZ>::GetChunkCacheStatistics() const
+{
+  ChunkCacheStatistics statistics;
+  statistics.hits = m_chunk_statistics.hits.load(std::memory_order_relaxed);
+  statistics.misses = m_chunk_statistics.misses.load(std::memory_order_relaxed);
+  statistics.prefetched = m_chunk_statistics.prefetched.load(std::memory_order_relaxed);
+  statistics.decompress_time =
+      std::chrono::nanoseconds(m_chunk_statistics.decompress_ns.load(std::memory_order_relaxed));
+  statistics.bytes_decompressed =
+      m_chunk_statistics.bytes_decompressed.load(std::memory_order_relaxed);
+  return statistics;
+}
+
 template <bool RVZ>
 BlobType WIARVZFileReader<RVZ>::GetBlobType() const
 {
@@ -496,6 +539,9 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_offset -= skipped_data;
   data_size += skipped_data;
 
+  const u64 full_chunk_size = chunk_size;
+  const u64 prefetch_depth = std::max<u64>(m_max_cached_chunks / 4, 1);
+
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
@@ -503,42 +549,32 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
+    const bool sequential = total_group_index == m_last_group_index + 1;
+    m_last_group_index = total_group_index;
 
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
-
-    if (group_data_size == 0)
+    ChunkDescription description;
+    if (!GetGroupChunkDescription(total_group_index, chunk_size, group_offset_in_data,
+                                  exception_lists, &description))
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(
+          description.offset_in_file, description.compressed_size, description.decompressed_size,
+          description.compression_type, description.exception_lists, description.rvz_packed_size,
+          description.data_offset);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        EvictCachedChunk(description.offset_in_file);
         return false;
       }
 
@@ -553,6 +589,26 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       }
     }
 
+    // Keep the worker threads a few chunks ahead of a sequential read.
+    if (sequential)
+    {
+      for (u64 j = i + 1; j < number_of_groups && j <= i + prefetch_depth; ++j)
+      {
+        const u64 next_group_offset_in_data = j * full_chunk_size;
+        if (group_index + j >= m_group_entries.size() || next_group_offset_in_data >= data_size)
+          break;
+
+        ChunkDescription next_description;
+        if (GetGroupChunkDescription(
+                group_index + j,
+                std::min(full_chunk_size, data_size - next_group_offset_in_data),
+                next_group_offset_in_data, exception_lists, &next_description))
+        {
+          PrefetchChunk(next_description);
+        }
+      }
+    }
+
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -561,6 +617,40 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::GetGroupChunkDescription(u64 total_group_index, u64 group_size,
+                                                     u64 group_offset_in_data,
+                                                     u32 exception_lists,
+                                                     ChunkDescription* description) const
+{
+  const GroupEntry& group = m_group_entries[total_group_index];
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  if (group_data_size == 0)
+    return false;
+
+  description->offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  description->compressed_size = group_data_size;
+  description->decompressed_size = group_size;
+  description->compression_type = compression_type;
+  description->exception_lists = exception_lists;
+  description->rvz_packed_size = rvz_packed_size;
+  description->data_offset = group_offset_in_data;
+  return true;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -568,11 +658,38 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  if (Chunk* chunk = FindCachedChunk(offset_in_file))
+  {
+    m_chunk_statistics.hits.fetch_add(1, std::memory_order_relaxed);
+    return *chunk;
+  }
+
+  // If a worker is already decompressing this chunk, waiting for it is faster than starting over.
+  MovePrefetchedChunksToCache(offset_in_file);
+  if (Chunk* chunk = FindCachedChunk(offset_in_file))
+  {
+    m_chunk_statistics.hits.fetch_add(1, std::memory_order_relaxed);
+    return *chunk;
+  }
+
+  m_chunk_statistics.misses.fetch_add(1, std::memory_order_relaxed);
+
+  const ChunkDescription description{offset_in_file,   compressed_size, decompressed_size,
+                                     compression_type, exception_lists, rvz_packed_size,
+                                     data_offset};
+  AddCachedChunk({offset_in_file, CreateChunk(&m_file, description)});
+  return *m_chunk_cache.back().chunk;
+}
+
+template <bool RVZ>
+std::unique_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkDescription& description)
+{
+  const u64 decompressed_size = description.decompressed_size;
+  const u32 rvz_packed_size = description.rvz_packed_size;
 
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (description.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
@@ -597,13 +714,137 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      description.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return std::make_unique<Chunk>(file, description.offset_in_file, description.compressed_size,
+                                 decompressed_size, description.exception_lists,
+                                 compressed_exception_lists, rvz_packed_size,
+                                 description.data_offset, std::move(decompressor),
+                                 &m_chunk_statistics);
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk* WIARVZFileReader<RVZ>::FindCachedChunk(u64 offset_in_file)
+{
+  const auto it =
+      std::find_if(m_chunk_cache.begin(), m_chunk_cache.end(), [&](const CachedChunk& cached) {
+        return cached.offset_in_file == offset_in_file;
+      });
+  if (it == m_chunk_cache.end())
+    return nullptr;
+
+  // Mark it as the most recently used chunk.
+  std::rotate(it, it + 1, m_chunk_cache.end());
+  return m_chunk_cache.back().chunk.get();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::AddCachedChunk(CachedChunk cached_chunk)
+{
+  if (m_chunk_cache.size() >= m_max_cached_chunks)
+    m_chunk_cache.erase(m_chunk_cache.begin());
+
+  m_chunk_cache.push_back(std::move(cached_chunk));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::EvictCachedChunk(u64 offset_in_file)
+{
+  const auto is_evicted = [&](const CachedChunk& cached) {
+    return cached.offset_in_file == offset_in_file;
+  };
+  m_chunk_cache.erase(std::remove_if(m_chunk_cache.begin(), m_chunk_cache.end(), is_evicted),
+                      m_chunk_cache.end());
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::MovePrefetchedChunksToCache(u64 offset_in_file)
+{
+  std::unique_lock<std::mutex> lock(m_prefetch_lock);
+  m_prefetch_done.wait(lock, [&] { return m_pending_prefetches.count(offset_in_file) == 0; });
+
+  for (CachedChunk& cached_chunk : m_prefetched_chunks)
+  {
+    EvictCachedChunk(cached_chunk.offset_in_file);
+    AddCachedChunk(std::move(cached_chunk));
+  }
+  m_prefetched_chunks.clear();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchChunk(const ChunkDescription& description)
+{
+  if (m_prefetch_failed || FindCachedChunk(description.offset_in_file))
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(m_prefetch_lock);
+    const bool already_prefetched =
+        std::any_of(m_prefetched_chunks.begin(), m_prefetched_chunks.end(),
+                    [&](const CachedChunk& cached) {
+                      return cached.offset_in_file == description.offset_in_file;
+                    });
+    if (already_prefetched || !m_pending_prefetches.insert(description.offset_in_file).second)
+      return;
+  }
+
+  if (m_prefetch_workers.empty() && !StartPrefetchWorkers())
+  {
+    std::lock_guard<std::mutex> guard(m_prefetch_lock);
+    m_pending_prefetches.erase(description.offset_in_file);
+    return;
+  }
+
+  m_prefetch_workers[m_next_prefetch_worker]->thread.EmplaceItem(description);
+  m_next_prefetch_worker = (m_next_prefetch_worker + 1) % m_prefetch_workers.size();
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::StartPrefetchWorkers()
+{
+  const u32 num_workers =
+      std::clamp<u32>(std::thread::hardware_concurrency() / 2, 1, MAX_PREFETCH_WORKERS);
+  for (u32 i = 0; i < num_workers; ++i)
+  {
+    auto worker = std::make_unique<PrefetchWorker>();
+    if (!worker->file.Open(m_path, "rb"))
+      break;
+
+    File::IOFile* file = &worker->file;
+    worker->thread.Reset([this, file](ChunkDescription description) {
+      PrefetchWorkerRun(file, std::move(description));
+    });
+    m_prefetch_workers.push_back(std::move(worker));
+  }
+
+  if (m_prefetch_workers.empty())
+  {
+    WARN_LOG_FMT(DISCIO, "Failed to open {} for prefetching", m_path);
+    m_prefetch_failed = true;
+    return false;
+  }
+
+  return true;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchWorkerRun(File::IOFile* file, ChunkDescription description)
+{
+  // Once the whole chunk is decompressed, the chunk never reads from the worker's file again,
+  // so it can be handed over to the reading thread.
+  std::unique_ptr<Chunk> chunk = CreateChunk(file, description);
+  const bool success = chunk->DecompressAll();
+  if (success)
+    m_chunk_statistics.prefetched.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    std::lock_guard<std::mutex> guard(m_prefetch_lock);
+    m_pending_prefetches.erase(description.offset_in_file);
+    if (success)
+      m_prefetched_chunks.push_back({description.offset_in_file, std::move(chunk)});
+  }
+  m_prefetch_done.notify_all();
 }
 
 template <bool RVZ>
@@ -627,10 +868,11 @@ template <bool RVZ>
 WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
                                     u64 decompressed_size, u32 exception_lists,
                                     bool compressed_exception_lists, u32 rvz_packed_size,
-                                    u64 data_offset, std::unique_ptr<Decompressor> decompressor)
+                                    u64 data_offset, std::unique_ptr<Decompressor> decompressor,
+                                    ChunkStatistics* statistics)
     : m_decompressor(std::move(decompressor)), m_file(file), m_offset_in_file(offset_in_file),
       m_exception_lists(exception_lists), m_compressed_exception_lists(compressed_exception_lists),
-      m_rvz_packed_size(rvz_packed_size), m_data_offset(data_offset)
+      m_rvz_packed_size(rvz_packed_size), m_data_offset(data_offset), m_statistics(statistics)
 {
   constexpr size_t MAX_SIZE_PER_EXCEPTION_LIST =
       Common::AlignUp(VolumeWii::BLOCK_HEADER_SIZE, sizeof(SHA1)) / sizeof(SHA1) *
@@ -753,6 +995,14 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
   return true;
 }
 
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  const u64 size = m_out.data.size() - m_out_bytes_allocated_for_exceptions;
+  u8 byte;
+  return size == 0 || Read(size - 1, 1, &byte);
+}
+
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Decompress()
 {
@@ -771,7 +1021,20 @@ bool WIARVZFileReader<RVZ>::Chunk::Decompress()
     m_rvz_packed_size = 0;
   }
 
-  return m_decompressor->Decompress(m_in, &m_out, &m_in_bytes_read);
+  if (!m_statistics)
+    return m_decompressor->Decompress(m_in, &m_out, &m_in_bytes_read);
+
+  const size_t bytes_written_before = m_out.bytes_written;
+  const auto start = std::chrono::steady_clock::now();
+  const bool success = m_decompressor->Decompress(m_in, &m_out, &m_in_bytes_read);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  m_statistics->decompress_ns.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+      std::memory_order_relaxed);
+  m_statistics->bytes_decompressed.fetch_add(m_out.bytes_written - bytes_written_before,
+                                             std::memory_order_relaxed);
+  return success;
 }
 
 template <bool RVZ>
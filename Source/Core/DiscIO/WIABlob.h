@@ -5,16 +5,23 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -66,6 +73,19 @@ public:
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
                                       int compression_level, int chunk_size, CompressCB callback);
 
+  struct ChunkCacheStatistics
+  {
+    // Chunks which were found already decompressed, including ones decompressed ahead of time.
+    u64 hits = 0;
+    // Chunks which had to be decompressed when they were read.
+    u64 misses = 0;
+    // Chunks which were decompressed ahead of time by the worker threads.
+    u64 prefetched = 0;
+    std::chrono::nanoseconds decompress_time{};
+    u64 bytes_decompressed = 0;
+  };
+  ChunkCacheStatistics GetChunkCacheStatistics() const;
+
 private:
   using SHA1 = std::array<u8, 20>;
   using WiiKey = std::array<u8, 16>;
@@ -177,16 +197,29 @@ private:
     }
   };
 
+  struct ChunkStatistics
+  {
+    std::atomic<u64> hits{0};
+    std::atomic<u64> misses{0};
+    std::atomic<u64> prefetched{0};
+    std::atomic<u64> decompress_ns{0};
+    std::atomic<u64> bytes_decompressed{0};
+  };
+
   class Chunk
   {
   public:
     Chunk();
     Chunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
           u32 exception_lists, bool compressed_exception_lists, u32 rvz_packed_size,
-          u64 data_offset, std::unique_ptr<Decompressor> decompressor);
+          u64 data_offset, std::unique_ptr<Decompressor> decompressor,
+          ChunkStatistics* statistics = nullptr);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Decompresses all of the data, so that reads never have to access the file again.
+    bool DecompressAll();
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -217,6 +250,32 @@ private:
     bool m_compressed_exception_lists = false;
     u32 m_rvz_packed_size = 0;
     u64 m_data_offset = 0;
+
+    ChunkStatistics* m_statistics = nullptr;
+  };
+
+  // Where a chunk is stored in the file, and how to decompress it.
+  struct ChunkDescription
+  {
+    u64 offset_in_file;
+    u64 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 exception_lists;
+    u32 rvz_packed_size;
+    u64 data_offset;
+  };
+
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    std::unique_ptr<Chunk> chunk;
+  };
+
+  struct PrefetchWorker
+  {
+    File::IOFile file;
+    Common::WorkQueueThread<ChunkDescription> thread;
   };
 
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
@@ -228,9 +287,21 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  // Returns false if the group contains no data, which means that it's all zeroes.
+  bool GetGroupChunkDescription(u64 total_group_index, u64 group_size, u64 group_offset_in_data,
+                                u32 exception_lists, ChunkDescription* description) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  std::unique_ptr<Chunk> CreateChunk(File::IOFile* file, const ChunkDescription& description);
+  Chunk* FindCachedChunk(u64 offset_in_file);
+  void AddCachedChunk(CachedChunk cached_chunk);
+  void EvictCachedChunk(u64 offset_in_file);
+  // Waits if a worker thread is still decompressing the given chunk.
+  void MovePrefetchedChunksToCache(u64 offset_in_file);
+  void PrefetchChunk(const ChunkDescription& description);
+  void PrefetchWorkerRun(File::IOFile* file, ChunkDescription description);
+  bool StartPrefetchWorkers();
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -355,11 +426,27 @@ private:
   bool m_valid;
   WIARVZCompressionType m_compression_type;
 
+  std::string m_path;
   File::IOFile m_file;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  // Decompressed chunks, least recently used first. Only accessed by the reading thread.
+  std::vector<CachedChunk> m_chunk_cache;
+  size_t m_max_cached_chunks = 0;
+  // The last group which was read, for detecting sequential reads.
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  ChunkStatistics m_chunk_statistics;
+
+  // Sequential reads make the worker threads decompress the next few chunks ahead of time.
+  // Each worker has its own file handle, so that it doesn't disturb the reading thread.
+  std::mutex m_prefetch_lock;
+  std::condition_variable m_prefetch_done;
+  std::set<u64> m_pending_prefetches;
+  std::vector<CachedChunk> m_prefetched_chunks;
+  std::vector<std::unique_ptr<PrefetchWorker>> m_prefetch_workers;
+  size_t m_next_prefetch_worker = 0;
+  bool m_prefetch_failed = false;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
@@ -0,0 +1,203 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Config/Config.h"
+#include "Common/File.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+
+namespace
+{
+using Milliseconds = std::chrono::duration<double, std::milli>;
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+// Without the stage timers, every stage would read as zero, so only frame times are reported.
+constexpr size_t NumReportedStages()
+{
+  return StageTimers::AVAILABLE ? StageTimers::NUM_STAGES : 0;
+}
+
+// Nearest-rank percentile of an already sorted list.
+std::chrono::nanoseconds Percentile(const std::vector<std::chrono::nanoseconds>& sorted,
+                                    double percentile)
+{
+  const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+void PrintSummaryRow(const char* name, std::vector<std::chrono::nanoseconds> values)
+{
+  std::sort(values.begin(), values.end());
+
+  std::chrono::nanoseconds sum{};
+  for (const std::chrono::nanoseconds value : values)
+    sum += value;
+
+  fmt::print("{:<16}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}\n", name,
+             Milliseconds(sum / values.size()).count(),
+             Milliseconds(Percentile(values, 50)).count(),
+             Milliseconds(Percentile(values, 90)).count(),
+             Milliseconds(Percentile(values, 99)).count(), Milliseconds(values.back()).count());
+}
+}  // namespace
+
+FifoBenchmark::FifoBenchmark(Options options, std::function<void()> stop_callback)
+    : m_options(std::move(options)), m_stop_callback(std::move(stop_callback))
+{
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  FifoPlayer::GetInstance().SetFileLoadedCallback({});
+  FifoPlayer::GetInstance().SetFrameWrittenCallback({});
+  if (m_stage_timers_enabled)
+    StageTimers::Disable();
+}
+
+void FifoBenchmark::Install()
+{
+  SConfig& config = SConfig::GetInstance();
+  config.bCPUThread = false;
+  config.m_EmulationSpeed = 0.0f;
+  // Read by FifoPlayer when it is first created, so this has to happen before GetInstance().
+  config.bLoopFifoReplay = true;
+  Config::SetCurrent(Config::GFX_VSYNC, false);
+
+  FifoPlayer& player = FifoPlayer::GetInstance();
+  player.SetFileLoadedCallback([this] { OnFileLoaded(); });
+  player.SetFrameWrittenCallback([this] { OnFrameBoundary(); });
+
+  if (!StageTimers::AVAILABLE)
+  {
+    fprintf(stderr, "Stage timing is not available in this build (ENABLE_STAGE_TIMERS is off), "
+                    "so only frame times are reported\n");
+    return;
+  }
+  StageTimers::Enable();
+  m_stage_timers_enabled = true;
+}
+
+void FifoBenchmark::OnFileLoaded()
+{
+  FifoPlayer& player = FifoPlayer::GetInstance();
+  if (!player.GetFile())
+    return;
+
+  if (m_options.end_frame)
+    player.SetFrameRangeEnd(*m_options.end_frame);
+  if (m_options.first_frame)
+    player.SetFrameRangeStart(*m_options.first_frame);
+
+  m_frame_range_start = player.GetFrameRangeStart();
+  m_frame_range_end = player.GetFrameRangeEnd();
+  if (m_frame_range_start >= m_frame_range_end)
+  {
+    fprintf(stderr, "The frame range %u-%u is empty (the FIFO log has %u frames)\n",
+            m_frame_range_start, m_frame_range_end, player.GetFile()->GetFrameCount());
+    m_finished = true;
+    m_stop_callback();
+  }
+}
+
+// Called on the CPU thread right before each frame is written, which is also right after the
+// previous frame has been fully processed by the GPU.
+void FifoBenchmark::OnFrameBoundary()
+{
+  if (m_finished)
+    return;
+
+  const Clock::time_point now = Clock::now();
+  const StageTimers::Durations stages = m_stage_times.Take();
+
+  if (m_current_frame)
+  {
+    m_frames.push_back({m_current_iteration, *m_current_frame, now - m_frame_start, stages});
+
+    if (*m_current_frame + 1 >= m_frame_range_end && ++m_current_iteration == m_options.iterations)
+    {
+      m_finished = true;
+      m_stop_callback();
+      return;
+    }
+  }
+
+  m_current_frame = FifoPlayer::GetInstance().GetCurrentFrameNum();
+  m_frame_start = Clock::now();
+}
+
+bool FifoBenchmark::Report() const
+{
+  if (m_frames.empty())
+  {
+    fprintf(stderr, "No frames were benchmarked\n");
+    return false;
+  }
+
+  // The first iteration compiles shaders and fills the caches, so it does not represent steady
+  // state performance. Leave it out of the summary unless it is all we have.
+  const u32 first_iteration = m_current_iteration > 1 ? 1 : 0;
+
+  std::vector<std::chrono::nanoseconds> totals;
+  std::array<std::vector<std::chrono::nanoseconds>, StageTimers::NUM_STAGES> stages;
+  for (const FrameTimes& frame : m_frames)
+  {
+    if (frame.iteration < first_iteration)
+      continue;
+
+    totals.push_back(frame.total);
+    for (size_t i = 0; i < StageTimers::NUM_STAGES; i++)
+      stages[i].push_back(frame.stages[i]);
+  }
+
+  fmt::print("Frames {}-{}, {} iterations, {} frames measured{}\n", m_frame_range_start,
+             m_frame_range_end - 1, m_current_iteration, totals.size(),
+             first_iteration != 0 ? " (first iteration excluded)" : "");
+  fmt::print("{:<16}{:>10}{:>10}{:>10}{:>10}{:>10}\n", "Time (ms)", "mean", "p50", "p90", "p99",
+             "max");
+  PrintSummaryRow("Frame", totals);
+  for (size_t i = 0; i < NumReportedStages(); i++)
+    PrintSummaryRow(StageTimers::GetStageName(static_cast<StageTimers::Stage>(i)), stages[i]);
+
+  return m_options.report_path.empty() || WriteReport();
+}
+
+bool FifoBenchmark::WriteReport() const
+{
+  File::IOFile file(m_options.report_path, "w");
+  if (!file)
+  {
+    fprintf(stderr, "Could not open %s for writing\n", m_options.report_path.c_str());
+    return false;
+  }
+
+  std::string header = "iteration,frame,total_us";
+  for (size_t i = 0; i < NumReportedStages(); i++)
+  {
+    header += fmt::format(",{}_us",
+                          StageTimers::GetStageColumnName(static_cast<StageTimers::Stage>(i)));
+  }
+  file.WriteString(header + '\n');
+
+  for (const FrameTimes& frame : m_frames)
+  {
+    std::string line =
+        fmt::format("{},{},{:.1f}", frame.iteration, frame.frame, Microseconds(frame.total).count());
+    for (size_t i = 0; i < NumReportedStages(); i++)
+      line += fmt::format(",{:.1f}", Microseconds(frame.stages[i]).count());
+    file.WriteString(line + '\n');
+  }
+
+  return file.IsGood();
+}
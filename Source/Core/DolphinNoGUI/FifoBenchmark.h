@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/StageTimers.h"
+
+// Plays a range of frames from a FIFO log a fixed number of times, as fast as possible, and
+// measures how long each frame took in total and in each stage of the video pipeline.
+// Emulation runs in single core mode so that all GPU work for a frame is done before the next
+// frame starts, which keeps the per-frame numbers reproducible.
+class FifoBenchmark
+{
+public:
+  struct Options
+  {
+    u32 iterations = 1;
+    std::optional<u32> first_frame;
+    // Exclusive.
+    std::optional<u32> end_frame;
+    // Per-frame timings are written to this file as CSV, if it is not empty.
+    std::string report_path;
+  };
+
+  FifoBenchmark(Options options, std::function<void()> stop_callback);
+  ~FifoBenchmark();
+
+  // Must be called before the FIFO log is booted.
+  void Install();
+
+  // Prints a summary to stdout and writes the per-frame report. Must be called after emulation
+  // has shut down.
+  bool Report() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct FrameTimes
+  {
+    u32 iteration;
+    u32 frame;
+    std::chrono::nanoseconds total;
+    StageTimers::Durations stages;
+  };
+
+  void OnFileLoaded();
+  void OnFrameBoundary();
+
+  bool WriteReport() const;
+
+  Options m_options;
+  std::function<void()> m_stop_callback;
+
+  u32 m_frame_range_start = 0;
+  u32 m_frame_range_end = 0;
+
+  bool m_stage_timers_enabled = false;
+  StageTimers::Interval m_stage_times;
+
+  bool m_finished = false;
+  std::optional<u32> m_current_frame;
+  u32 m_current_iteration = 0;
+  Clock::time_point m_frame_start;
+  std::vector<FrameTimes> m_frames;
+};
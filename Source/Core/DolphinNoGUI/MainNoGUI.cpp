@@ -5,11 +5,14 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <signal.h>
 #include <string>
+#include <variant>
 #ifndef _WIN32
 #include <unistd.h>
 #else
@@ -24,6 +27,8 @@
 #include "Core/Core.h"
 #include "Core/Host.h"
 
+#include "DolphinNoGUI/FifoBenchmark.h"
+
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
 #include "UICommon/DiscordPresence.h"
@@ -159,6 +164,27 @@ int main(int argc, char* argv[])
 #endif
       });
 
+  parser->add_option("--benchmark")
+      .action("store")
+      .type("int")
+      .metavar("<iterations>")
+      .help("Play a FIFO log the given number of times as fast as possible, and report how long "
+            "each frame took");
+  parser->add_option("--benchmark_first_frame")
+      .action("store")
+      .type("int")
+      .metavar("<frame>")
+      .help("First frame of the FIFO log to benchmark");
+  parser->add_option("--benchmark_end_frame")
+      .action("store")
+      .type("int")
+      .metavar("<frame>")
+      .help("Frame of the FIFO log to stop benchmarking at (exclusive)");
+  parser->add_option("--benchmark_report")
+      .action("store")
+      .metavar("<file>")
+      .help("Write the timings of every benchmarked frame to a CSV file");
+
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
 
   std::vector<std::string> args = parser->args();
@@ -203,6 +229,28 @@ int main(int argc, char* argv[])
     return 0;
   }
 
+  std::unique_ptr<FifoBenchmark> benchmark;
+  if (options.is_set("benchmark"))
+  {
+    if (!boot || !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      fprintf(stderr, "Only FIFO logs can be benchmarked.\n");
+      return 1;
+    }
+
+    FifoBenchmark::Options benchmark_options;
+    benchmark_options.iterations = std::max(static_cast<int>(options.get("benchmark")), 1);
+    if (options.is_set("benchmark_first_frame"))
+      benchmark_options.first_frame = static_cast<int>(options.get("benchmark_first_frame"));
+    if (options.is_set("benchmark_end_frame"))
+      benchmark_options.end_frame = static_cast<int>(options.get("benchmark_end_frame"));
+    if (options.is_set("benchmark_report"))
+      benchmark_options.report_path = static_cast<const char*>(options.get("benchmark_report"));
+
+    benchmark = std::make_unique<FifoBenchmark>(std::move(benchmark_options),
+                                                [] { s_platform->Stop(); });
+  }
+
   std::string user_directory;
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
@@ -250,6 +298,9 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance().ReportDolphinStart("nogui");
 
+  if (benchmark)
+    benchmark->Install();
+
   if (!BootManager::BootCore(std::move(boot), s_platform->GetWindowSystemInfo()))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -264,8 +315,12 @@ int main(int argc, char* argv[])
   Core::Stop();
 
   Core::Shutdown();
+
+  const bool benchmark_succeeded = !benchmark || benchmark->Report();
+  benchmark.reset();
+
   s_platform.reset();
   UICommon::Shutdown();
 
-  return 0;
+  return benchmark_succeeded ? 0 : 1;
 }
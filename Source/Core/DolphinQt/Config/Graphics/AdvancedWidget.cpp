@@ -23,6 +23,7 @@
 #include "DolphinQt/Config/ToolTipControls/ToolTipCheckBox.h"
 #include "DolphinQt/Settings.h"
 
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/VideoConfig.h"
 
 AdvancedWidget::AdvancedWidget(GraphicsWindow* parent)
@@ -55,11 +56,18 @@ void AdvancedWidget::CreateWidgets()
       new GraphicsBool(tr("Texture Format Overlay"), Config::GFX_TEXFMT_OVERLAY_ENABLE);
   m_enable_api_validation =
       new GraphicsBool(tr("Enable API Validation Layers"), Config::GFX_ENABLE_VALIDATION_LAYER);
+  m_show_stage_times = new GraphicsBool(tr("Show Stage Timing"), Config::GFX_OVERLAY_STAGE_TIMES);
+  m_log_stage_times =
+      new GraphicsBool(tr("Log Stage Timing to File"), Config::GFX_LOG_STAGE_TIMES_TO_FILE);
+  m_show_stage_times->setEnabled(StageTimers::AVAILABLE);
+  m_log_stage_times->setEnabled(StageTimers::AVAILABLE);
 
   debugging_layout->addWidget(m_enable_wireframe, 0, 0);
   debugging_layout->addWidget(m_show_statistics, 0, 1);
   debugging_layout->addWidget(m_enable_format_overlay, 1, 0);
   debugging_layout->addWidget(m_enable_api_validation, 1, 1);
+  debugging_layout->addWidget(m_show_stage_times, 2, 0);
+  debugging_layout->addWidget(m_log_stage_times, 2, 1);
 
   // Utility
   auto* utility_box = new QGroupBox(tr("Utility"));
@@ -151,7 +159,11 @@ void AdvancedWidget::CreateWidgets()
   m_defer_efb_access_invalidation =
       new GraphicsBool(tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION);
 
+  m_predictive_efb_readback =
+      new GraphicsBool(tr("Predictive EFB Readback"), Config::GFX_HACK_EFB_PREDICTIVE_READBACK);
+
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
+  experimental_layout->addWidget(m_predictive_efb_readback, 0, 1);
 
   main_layout->addWidget(debugging_box);
   main_layout->addWidget(utility_box);
@@ -215,6 +227,14 @@ void AdvancedWidget::AddDescriptions()
   static const char TR_SHOW_STATS_DESCRIPTION[] =
       QT_TR_NOOP("Shows various rendering statistics.<br><br><dolphin_emphasis>If unsure, "
                  "leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_STAGE_TIMES_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how much time each frame spends in CPU emulation, command processing, "
+                 "shader lookup, presentation and other stages.<br><br><dolphin_emphasis>If "
+                 "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_LOG_STAGE_TIMES_DESCRIPTION[] =
+      QT_TR_NOOP("Logs the time each frame spends in each stage to "
+                 "User/Logs/stage_times.csv.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_TEXTURE_FORMAT_DESCRIPTION[] =
       QT_TR_NOOP("Modifies textures to show the format they're encoded in.<br><br>May require "
                  "an emulation "
@@ -302,6 +322,12 @@ void AdvancedWidget::AddDescriptions()
       "<br><br>May improve performance in some games which rely on CPU EFB Access at the cost "
       "of stability.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_PREDICTIVE_EFB_READBACK_DESCRIPTION[] = QT_TR_NOOP(
+      "At the end of each frame, reads back the parts of the EFB that the CPU accessed during "
+      "that frame without waiting for the GPU. Accesses in the following frame are answered from "
+      "this copy instead of stalling the GPU.<br><br>May improve performance in games which read "
+      "the EFB every frame, but the values read may be up to a frame old.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
 #ifdef _WIN32
   static const char TR_BORDERLESS_FULLSCREEN_DESCRIPTION[] = QT_TR_NOOP(
@@ -316,6 +342,8 @@ void AdvancedWidget::AddDescriptions()
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
   m_enable_format_overlay->SetDescription(tr(TR_TEXTURE_FORMAT_DESCRIPTION));
   m_enable_api_validation->SetDescription(tr(TR_VALIDATION_LAYER_DESCRIPTION));
+  m_show_stage_times->SetDescription(tr(TR_SHOW_STAGE_TIMES_DESCRIPTION));
+  m_log_stage_times->SetDescription(tr(TR_LOG_STAGE_TIMES_DESCRIPTION));
   m_dump_textures->SetDescription(tr(TR_DUMP_TEXTURE_DESCRIPTION));
   m_dump_mip_textures->SetDescription(tr(TR_DUMP_MIP_TEXTURE_DESCRIPTION));
   m_dump_base_textures->SetDescription(tr(TR_DUMP_BASE_TEXTURE_DESCRIPTION));
@@ -337,4 +365,5 @@ void AdvancedWidget::AddDescriptions()
   m_borderless_fullscreen->SetDescription(tr(TR_BORDERLESS_FULLSCREEN_DESCRIPTION));
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
+  m_predictive_efb_readback->SetDescription(tr(TR_PREDICTIVE_EFB_READBACK_DESCRIPTION));
 }
@@ -36,6 +36,8 @@ private:
   GraphicsBool* m_show_statistics;
   GraphicsBool* m_enable_format_overlay;
   GraphicsBool* m_enable_api_validation;
+  GraphicsBool* m_show_stage_times;
+  GraphicsBool* m_log_stage_times;
 
   // Utility
   GraphicsBool* m_prefetch_custom_textures;
@@ -63,4 +65,5 @@ private:
 
   // Experimental
   GraphicsBool* m_defer_efb_access_invalidation;
+  GraphicsBool* m_predictive_efb_readback;
 };
@@ -664,6 +664,12 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    if (IsHotkey(HK_REWIND_STEP_BACK))
+      emit StateRewindStepBack();
+
+    if (IsHotkey(HK_REWIND_SEEK_BACK))
+      emit StateRewindSeekBack();
   }
 }
 
@@ -45,6 +45,8 @@ signals:
   void StateSaveFile();
   void StateLoadUndo();
   void StateSaveUndo();
+  void StateRewindStepBack();
+  void StateRewindSeekBack();
   void StartRecording();
   void ExportRecording();
   void ToggleReadOnlyMode();
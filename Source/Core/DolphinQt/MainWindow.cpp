@@ -553,6 +553,10 @@ void MainWindow::ConnectHotkeys()
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveUndo, this, &MainWindow::StateSaveUndo);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveOldest, this,
           &MainWindow::StateSaveOldest);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateRewindStepBack, this,
+          &MainWindow::StateRewindStepBack);
+  connect(m_hotkey_scheduler, &HotkeyScheduler::StateRewindSeekBack, this,
+          &MainWindow::StateRewindSeekBack);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateSaveFile, this, &MainWindow::StateSave);
   connect(m_hotkey_scheduler, &HotkeyScheduler::StateLoadFile, this, &MainWindow::StateLoad);
 
@@ -1253,6 +1257,16 @@ void MainWindow::StateSaveOldest()
   State::SaveFirstSaved();
 }
 
+void MainWindow::StateRewindStepBack()
+{
+  State::RewindStepBack();
+}
+
+void MainWindow::StateRewindSeekBack()
+{
+  State::RewindSeekBack();
+}
+
 void MainWindow::SetStateSlot(int slot)
 {
   Settings::Instance().SetStateSlot(slot);
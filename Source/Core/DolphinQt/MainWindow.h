@@ -99,6 +99,8 @@ private:
   void StateLoadUndo();
   void StateSaveUndo();
   void StateSaveOldest();
+  void StateRewindStepBack();
+  void StateRewindSeekBack();
   void SetStateSlot(int slot);
   void BootWiiSystemMenu();
 
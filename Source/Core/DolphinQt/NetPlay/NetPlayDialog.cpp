@@ -503,6 +503,8 @@ void NetPlayDialog::OnStart()
   settings.m_DeferEFBCopies = Config::Get(Config::GFX_HACK_DEFER_EFB_COPIES);
   settings.m_EFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   settings.m_EFBAccessDeferInvalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
+  settings.m_EFBAccessPredictiveReadback = Config::Get(Config::GFX_HACK_EFB_PREDICTIVE_READBACK);
+  settings.m_EFBAccessMaxStaleFrames = Config::Get(Config::GFX_HACK_EFB_ACCESS_MAX_STALE_FRAMES);
   settings.m_StrictSettingsSync = m_strict_settings_sync_action->isChecked();
   settings.m_SyncSaveData = m_sync_save_data_action->isChecked();
   settings.m_SyncCodes = m_sync_codes_action->isChecked();
@@ -5,12 +5,17 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -20,6 +25,8 @@
 #include "Common/File.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/MappedFile.h"
+#include "Common/Thread.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -27,7 +34,77 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 19;  // Last changed in PR 9135
+static constexpr u32 CACHE_REVISION = 20;  // Last changed for the append-only cache format
+
+// The cache file is the revision followed by a list of entries. Each entry is this header, the
+// path and the state of the GameFile. Saving appends entries for changed files, so a later entry
+// for a path replaces the earlier ones, and an entry without a state means the file was removed.
+struct CacheEntryHeader
+{
+  u32 path_size;
+  u32 state_size;
+  u64 file_size;
+  s64 modification_time;
+};
+
+static bool WriteEntry(File::IOFile* file, const std::string& path, u64 file_size,
+                       s64 modification_time, GameFile* game_file)
+{
+  std::vector<u8> state;
+  if (game_file)
+  {
+    // Measure the size of the buffer.
+    u8* ptr = nullptr;
+    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+    game_file->DoState(p);
+    const size_t state_size = reinterpret_cast<size_t>(ptr);
+
+    // Then actually do the write.
+    state.resize(state_size);
+    ptr = state.data();
+    p.SetMode(PointerWrap::MODE_WRITE);
+    game_file->DoState(p);
+  }
+
+  const CacheEntryHeader header = {static_cast<u32>(path.size()), static_cast<u32>(state.size()),
+                                   file_size, modification_time};
+  return file->WriteArray(&header, 1) && file->WriteBytes(path.data(), path.size()) &&
+         file->WriteBytes(state.data(), state.size());
+}
+
+// Calls task for every index below count, on a few threads, until processing_halted is set.
+static void RunInParallel(size_t count, const std::atomic_bool& processing_halted,
+                          const std::function<void(size_t)>& task)
+{
+  std::atomic<size_t> next_index{0};
+  const auto run = [&] {
+    while (!processing_halted)
+    {
+      const size_t i = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (i >= count)
+        break;
+      task(i);
+    }
+  };
+
+  // Scanning is bound by storage latency rather than by the CPU, so this uses a few threads even
+  // on machines with few cores, but not so many that hard drives start seeking back and forth.
+  const size_t num_threads =
+      std::min<size_t>(std::clamp(std::thread::hardware_concurrency(), 2u, 8u), count);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; ++i)
+  {
+    threads.emplace_back([&run] {
+      Common::SetCurrentThreadName("Game list scanner");
+      run();
+    });
+  }
+
+  run();
+
+  for (std::thread& thread : threads)
+    thread.join();
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -64,6 +141,8 @@ void GameFileCache::Clear(DeleteOnDisk delete_on_disk)
     File::Delete(m_path);
 
   m_cached_files.clear();
+  m_file_stamps.clear();
+  ForgetSavedFiles();
 }
 
 std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
@@ -78,6 +157,7 @@ std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
     std::shared_ptr<UICommon::GameFile> game = std::make_shared<GameFile>(path);
     if (!game->IsValid())
       return nullptr;
+    m_file_stamps[path] = GetFileStamp(path);
     m_cached_files.emplace_back(std::move(game));
   }
   std::shared_ptr<GameFile>& result = found ? *it : m_cached_files.back();
@@ -127,6 +207,7 @@ bool GameFileCache::Update(
           game_removed_from_cache((*it)->GetFilePath());
 
         cache_changed = true;
+        m_file_stamps.erase((*it)->GetFilePath());
         --end;
         *it = std::move(*end);
       }
@@ -134,24 +215,80 @@ bool GameFileCache::Update(
     m_cached_files.erase(it, m_cached_files.end());
   }
 
-  // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
+  // Now that the previous loop has run, game_paths only contains paths that aren't in
+  // m_cached_files. Those are scanned, along with cached files that changed on disk since they
+  // were scanned. Opening volumes and reading banners is mostly waiting for storage, so this is
+  // spread over several threads.
+  struct ScanTask
+  {
+    std::string path;
+    // The index in m_cached_files, or SIZE_MAX for new files.
+    size_t cached_index;
+    FileStamp previous_stamp;
+    bool has_previous_stamp;
+
+    FileStamp stamp;
+    bool scanned = false;
+    std::shared_ptr<GameFile> file;
+  };
+
+  std::vector<ScanTask> tasks;
+  tasks.reserve(m_cached_files.size() + game_paths.size());
+  for (size_t i = 0; i < m_cached_files.size(); ++i)
+  {
+    const std::string& path = m_cached_files[i]->GetFilePath();
+    const auto stamp_it = m_file_stamps.find(path);
+    const bool has_stamp = stamp_it != m_file_stamps.end();
+    tasks.push_back({path, i, has_stamp ? stamp_it->second : FileStamp{}, has_stamp});
+  }
   for (const std::string& path : game_paths)
+    tasks.push_back({path, SIZE_MAX, {}, false});
+
+  RunInParallel(tasks.size(), processing_halted, [&tasks](size_t i) {
+    ScanTask& task = tasks[i];
+    task.stamp = GetFileStamp(task.path);
+    if (task.has_previous_stamp && task.stamp == task.previous_stamp)
+      return;
+
+    task.file = std::make_shared<GameFile>(task.path);
+    task.scanned = true;
+  });
+
+  std::vector<size_t> invalid_cached_indices;
+  for (ScanTask& task : tasks)
   {
-    if (processing_halted)
-      break;
+    if (!task.scanned)
+      continue;
+
+    const bool is_cached = task.cached_index != SIZE_MAX;
+    if (is_cached && game_removed_from_cache)
+      game_removed_from_cache(task.path);
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    const bool valid = task.file->IsValid();
+    if (valid)
     {
       if (game_added_to_cache)
-        game_added_to_cache(file);
+        game_added_to_cache(task.file);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+      m_file_stamps[task.path] = task.stamp;
+      if (is_cached)
+        m_cached_files[task.cached_index] = std::move(task.file);
+      else
+        m_cached_files.push_back(std::move(task.file));
     }
+    else if (is_cached)
+    {
+      m_file_stamps.erase(task.path);
+      invalid_cached_indices.push_back(task.cached_index);
+    }
+
+    cache_changed |= is_cached || valid;
   }
 
+  // Indices are in increasing order, so erasing from the back keeps the others valid.
+  for (auto it = invalid_cached_indices.rbegin(); it != invalid_cached_indices.rend(); ++it)
+    m_cached_files.erase(m_cached_files.begin() + *it);
+
   return cache_changed;
 }
 
@@ -214,79 +351,213 @@ bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_fil
 
 bool GameFileCache::Load()
 {
-  return SyncCacheFile(false);
+  File::IOFile file(m_path, "rb");
+  if (!file)
+    return false;
+
+  // Map the cache file if possible, so that outdated entries are never even read.
+  File::MappedFile mapping;
+  std::vector<u8> buffer;
+  const u8* data;
+  u64 size;
+  if (mapping.Map(file))
+  {
+    data = mapping.GetData();
+    size = mapping.GetSize();
+  }
+  else
+  {
+    buffer.resize(file.GetSize());
+    if (!file.ReadBytes(buffer.data(), buffer.size()))
+      buffer.clear();
+    data = buffer.data();
+    size = buffer.size();
+  }
+  file.Close();
+
+  // Find the latest entry for each path. Later entries replace earlier ones.
+  struct Entry
+  {
+    CacheEntryHeader header;
+    const u8* state;
+  };
+  std::unordered_map<std::string, Entry> entries;
+  size_t num_entries = 0;
+
+  u32 revision = 0;
+  bool success = size >= sizeof(revision);
+  if (success)
+  {
+    std::memcpy(&revision, data, sizeof(revision));
+    success = revision == CACHE_REVISION;
+  }
+
+  u64 offset = sizeof(revision);
+  while (success && offset < size)
+  {
+    Entry entry;
+    if (size - offset < sizeof(entry.header))
+    {
+      success = false;
+      break;
+    }
+    std::memcpy(&entry.header, data + offset, sizeof(entry.header));
+    offset += sizeof(entry.header);
+
+    if (size - offset < u64(entry.header.path_size) + entry.header.state_size)
+    {
+      success = false;
+      break;
+    }
+    std::string path(reinterpret_cast<const char*>(data + offset), entry.header.path_size);
+    entry.state = data + offset + entry.header.path_size;
+    offset += u64(entry.header.path_size) + entry.header.state_size;
+
+    entries[std::move(path)] = entry;
+    ++num_entries;
+  }
+
+  std::vector<std::shared_ptr<GameFile>> cached_files;
+  std::unordered_map<std::string, FileStamp> file_stamps;
+  for (const auto& [path, entry] : entries)
+  {
+    if (!success)
+      break;
+
+    // Removed files are stored as entries without a state.
+    if (entry.header.state_size == 0)
+      continue;
+
+    // PointerWrap only reads from the data in MODE_READ.
+    u8* ptr = const_cast<u8*>(entry.state);
+    PointerWrap p(&ptr, PointerWrap::MODE_READ);
+    auto game_file = std::make_shared<GameFile>();
+    game_file->DoState(p);
+    success = p.GetMode() == PointerWrap::MODE_READ && ptr == entry.state + entry.header.state_size;
+
+    file_stamps[path] = {entry.header.file_size, entry.header.modification_time};
+    cached_files.push_back(std::move(game_file));
+  }
+
+  if (!success)
+  {
+    // Try to delete the probably-corrupted cache
+    mapping.Unmap();
+    File::Delete(m_path);
+    return false;
+  }
+
+  m_cached_files = std::move(cached_files);
+  m_file_stamps = std::move(file_stamps);
+  m_saved_files.clear();
+  for (const std::shared_ptr<GameFile>& game_file : m_cached_files)
+    m_saved_files.emplace(game_file->GetFilePath(), game_file);
+  m_num_saved_entries = num_entries;
+  return true;
 }
 
 bool GameFileCache::Save()
 {
-  return SyncCacheFile(true);
-}
+  // Rewriting drops outdated entries, which otherwise would make loading slower over time.
+  if (m_saved_files.empty() || m_num_saved_entries > 2 * m_cached_files.size() + 16 ||
+      !File::Exists(m_path))
+  {
+    return Rewrite();
+  }
 
-bool GameFileCache::SyncCacheFile(bool save)
-{
-  const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
-  if (!f)
+  File::IOFile file(m_path, "ab");
+  if (!file)
     return false;
-  bool success = false;
-  if (save)
-  {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-    DoState(&p);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
 
-    // Then actually do the write.
-    std::vector<u8> buffer(buffer_size);
-    ptr = &buffer[0];
-    p.SetMode(PointerWrap::MODE_WRITE);
-    DoState(&p, buffer_size);
-    if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
+  bool success = true;
+  std::unordered_set<std::string> cached_paths;
+  for (const std::shared_ptr<GameFile>& game_file : m_cached_files)
+  {
+    const std::string& path = game_file->GetFilePath();
+    cached_paths.insert(path);
+
+    // Updated files are replaced by copies, so comparing pointers finds every change.
+    std::shared_ptr<const GameFile>& saved_file = m_saved_files[path];
+    if (saved_file == game_file)
+      continue;
+
+    const FileStamp& stamp = m_file_stamps[path];
+    success = success &&
+              WriteEntry(&file, path, stamp.size, stamp.modification_time, game_file.get());
+    saved_file = game_file;
+    ++m_num_saved_entries;
   }
-  else
+
+  for (auto it = m_saved_files.begin(); it != m_saved_files.end();)
   {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+    if (cached_paths.count(it->first))
     {
-      u8* ptr = buffer.data();
-      PointerWrap p(&ptr, PointerWrap::MODE_READ);
-      DoState(&p, buffer.size());
-      if (p.GetMode() == PointerWrap::MODE_READ)
-        success = true;
+      ++it;
+      continue;
     }
+
+    success = success && WriteEntry(&file, it->first, 0, 0, nullptr);
+    it = m_saved_files.erase(it);
+    ++m_num_saved_entries;
   }
+
   if (!success)
   {
     // If some file operation failed, try to delete the probably-corrupted cache
-    f.Close();
+    file.Close();
     File::Delete(m_path);
+    ForgetSavedFiles();
   }
   return success;
 }
 
-void GameFileCache::DoState(PointerWrap* p, u64 size)
+bool GameFileCache::Rewrite()
 {
-  struct
-  {
-    u32 revision;
-    u64 expected_size;
-  } header = {CACHE_REVISION, size};
-  p->Do(header);
-  if (p->GetMode() == PointerWrap::MODE_READ)
+  ForgetSavedFiles();
+
+  // Write to a temporary file, so that a failed write doesn't lose the old cache.
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(m_path);
   {
-    if (header.revision != CACHE_REVISION || header.expected_size != size)
+    File::IOFile file(temp_path, "wb");
+    bool success = file.WriteArray(&CACHE_REVISION, 1);
+    for (const std::shared_ptr<GameFile>& game_file : m_cached_files)
     {
-      p->SetMode(PointerWrap::MODE_MEASURE);
-      return;
+      const std::string& path = game_file->GetFilePath();
+      const FileStamp& stamp = m_file_stamps[path];
+      success = success &&
+                WriteEntry(&file, path, stamp.size, stamp.modification_time, game_file.get());
+    }
+
+    if (!success)
+    {
+      file.Close();
+      File::Delete(temp_path);
+      return false;
     }
   }
-  p->DoEachElement(m_cached_files, [](PointerWrap& state, std::shared_ptr<GameFile>& elem) {
-    if (state.GetMode() == PointerWrap::MODE_READ)
-      elem = std::make_shared<GameFile>();
-    elem->DoState(state);
-  });
+
+  if (!File::Rename(temp_path, m_path))
+  {
+    File::Delete(temp_path);
+    return false;
+  }
+
+  for (const std::shared_ptr<GameFile>& game_file : m_cached_files)
+    m_saved_files.emplace(game_file->GetFilePath(), game_file);
+  m_num_saved_entries = m_cached_files.size();
+  return true;
+}
+
+void GameFileCache::ForgetSavedFiles()
+{
+  m_saved_files.clear();
+  m_num_saved_entries = 0;
+}
+
+GameFileCache::FileStamp GameFileCache::GetFileStamp(const std::string& path)
+{
+  const File::FileInfo info(path);
+  return {info.GetSize(), info.GetModificationTime()};
 }
 
 }  // namespace UICommon
@@ -9,12 +9,11 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 
-class PointerWrap;
-
 namespace UICommon
 {
 class GameFile;
@@ -43,6 +42,8 @@ public:
   std::shared_ptr<const GameFile> AddOrGet(const std::string& path, bool* cache_changed);
 
   // These functions return true if the call modified the cache.
+  // Update scans new and modified files on several threads. The callbacks are called on the
+  // calling thread.
   bool Update(const std::vector<std::string>& all_game_paths,
               std::function<void(const std::shared_ptr<const GameFile>&)> game_added_to_cache = {},
               std::function<void(const std::string&)> game_removed_from_cache = {},
@@ -52,16 +53,41 @@ public:
       const std::atomic_bool& processing_halted = false);
 
   bool Load();
+  // Only appends the files that changed since the last save, unless the cache file is mostly
+  // made up of outdated entries, in which case it gets rewritten.
   bool Save();
 
 private:
+  // Identifies a version of a game file on disk.
+  struct FileStamp
+  {
+    u64 size = 0;
+    s64 modification_time = 0;
+
+    bool operator==(const FileStamp& other) const
+    {
+      return size == other.size && modification_time == other.modification_time;
+    }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+  };
+
+  static FileStamp GetFileStamp(const std::string& path);
+
   bool UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file);
 
-  bool SyncCacheFile(bool save);
-  void DoState(PointerWrap* p, u64 size = 0);
+  bool Rewrite();
+  void ForgetSavedFiles();
 
   std::string m_path;
   std::vector<std::shared_ptr<GameFile>> m_cached_files;
+  // The size and modification time of each game file when it was scanned. Files that no longer
+  // match are scanned again.
+  std::unordered_map<std::string, FileStamp> m_file_stamps;
+
+  // The version of each game file that the cache file contains.
+  std::unordered_map<std::string, std::shared_ptr<const GameFile>> m_saved_files;
+  // Number of entries in the cache file, including outdated ones.
+  size_t m_num_saved_entries = 0;
 };
 
 }  // namespace UICommon
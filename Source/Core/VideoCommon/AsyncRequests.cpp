@@ -21,7 +21,7 @@ void AsyncRequests::PullEventsInternal()
 {
   // This is only called if the queue isn't empty.
   // So just flush the pipeline to get accurate results.
-  g_vertex_manager->Flush();
+  g_vertex_manager->Flush(FlushReason::AsyncRequest);
 
   std::unique_lock<std::mutex> lock(m_mutex);
   m_empty.Set();
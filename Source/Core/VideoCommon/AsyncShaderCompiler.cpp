@@ -58,6 +58,12 @@ bool AsyncShaderCompiler::HasPendingWork()
   return !m_pending_work.empty() || m_busy_workers.load() != 0;
 }
 
+size_t AsyncShaderCompiler::GetPendingWorkCount()
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  return m_pending_work.size() + m_busy_workers.load();
+}
+
 bool AsyncShaderCompiler::HasCompletedWork()
 {
   std::lock_guard<std::mutex> guard(m_completed_work_lock);
@@ -50,6 +50,9 @@ public:
   bool HasPendingWork();
   bool HasCompletedWork();
 
+  // Number of work items that are queued or currently being compiled.
+  size_t GetPendingWorkCount();
+
   // Simpler version without progress updates.
   void WaitUntilCompletion();
 
@@ -29,7 +29,7 @@ namespace BPFunctions
 
 void FlushPipeline()
 {
-  g_vertex_manager->Flush();
+  g_vertex_manager->Flush(FlushReason::BPRegister);
 }
 
 void SetGenerationMode()
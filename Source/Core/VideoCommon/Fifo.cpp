@@ -5,6 +5,7 @@
 #include "VideoCommon/Fifo.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstring>
 
 #include "Common/Assert.h"
@@ -26,6 +27,7 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -35,6 +37,11 @@ namespace Fifo
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// In adaptive handoff mode, a sleeping GPU thread is only woken once this much data is queued,
+static constexpr u32 HANDOFF_BATCH_SIZE = 4096;
+// or once this many CPU cycles have passed since the first write it hasn't been woken for.
+static constexpr int HANDOFF_LATENCY_BUDGET = 10000;
+
 static Common::BlockingLoop s_gpu_mainloop;
 
 static Common::Flag s_emu_running_state;
@@ -49,6 +56,17 @@ static u8* s_fifo_aux_read_ptr;
 static bool s_use_deterministic_gpu_thread;
 
 static CoreTiming::EventType* s_event_sync_gpu;
+static CoreTiming::EventType* s_event_flush_handoff;
+
+// Dual core only. Batches wakeups of the GPU thread, and replaces its busy loop with a short
+// adaptive spin, see BlockingLoop::SetAdaptiveSpin.
+static bool s_adaptive_handoff;
+// Set when there is data the GPU thread hasn't been woken for yet.
+static std::atomic<bool> s_handoff_pending;
+
+static u64 s_initial_gpu_wakeups;
+static std::atomic<u64> s_num_sync_stalls;
+static std::atomic<s64> s_blocked_time_ns;
 
 // STATE_TO_SAVE
 static u8* s_video_buffer;
@@ -89,6 +107,34 @@ void DoState(PointerWrap& p)
   p.Do(s_syncing_suspended);
 }
 
+// Wakes the GPU thread if a wakeup was held back to batch it with later writes.
+static void FlushHandoff()
+{
+  if (s_handoff_pending.exchange(false))
+    s_gpu_mainloop.Wakeup();
+}
+
+static void RecordSyncStall(std::chrono::steady_clock::time_point start)
+{
+  s_num_sync_stalls++;
+  s_blocked_time_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+}
+
+// Blocks the calling thread until the GPU thread has processed everything queued so far.
+static void WaitForGpuLoop()
+{
+  FlushHandoff();
+  if (s_gpu_mainloop.IsDone())
+    return;
+
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::SyncGPUWait);
+  const auto start = std::chrono::steady_clock::now();
+  s_gpu_mainloop.Wait();
+  RecordSyncStall(start);
+}
+
 void PauseAndLock(bool doLock, bool unpauseOnUnlock)
 {
   if (doLock)
@@ -101,6 +147,7 @@ void PauseAndLock(bool doLock, bool unpauseOnUnlock)
     if (!param.bCPUThread || s_use_deterministic_gpu_thread)
       return;
 
+    FlushHandoff();
     s_gpu_mainloop.WaitYield(std::chrono::milliseconds(100), Host_YieldToUI);
   }
   else
@@ -118,6 +165,14 @@ void Init()
   if (SConfig::GetInstance().bCPUThread)
     s_gpu_mainloop.Prepare();
   s_sync_ticks.store(0);
+
+  const SConfig& param = SConfig::GetInstance();
+  s_adaptive_handoff = param.bCPUThread && param.bAdaptiveGpuHandoff;
+  s_gpu_mainloop.SetAdaptiveSpin(s_adaptive_handoff);
+  s_handoff_pending.store(false);
+  s_initial_gpu_wakeups = s_gpu_mainloop.GetWakeupCount();
+  s_num_sync_stalls.store(0);
+  s_blocked_time_ns.store(0);
 }
 
 void Shutdown()
@@ -161,7 +216,7 @@ void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (s_use_deterministic_gpu_thread)
   {
-    s_gpu_mainloop.Wait();
+    WaitForGpuLoop();
     if (!s_gpu_mainloop.IsRunning())
       return;
 
@@ -385,7 +440,7 @@ void RunGpuLoop()
 
           // The fifo is empty and it's unlikely we will get any more work in the near future.
           // Make sure VertexManager finishes drawing any primitives it has stored in it's buffer.
-          g_vertex_manager->Flush();
+          g_vertex_manager->Flush(FlushReason::FifoIdle);
         }
       },
       100);
@@ -401,7 +456,7 @@ void FlushGpu()
   if (!param.bCPUThread || s_use_deterministic_gpu_thread)
     return;
 
-  s_gpu_mainloop.Wait();
+  WaitForGpuLoop();
 }
 
 void GpuMaySleep()
@@ -415,32 +470,67 @@ bool AtBreakpoint()
   return fifo.bFF_BPEnable && (fifo.CPReadPointer == fifo.CPBreakpoint);
 }
 
+static void ResumeSyncGPUCallback()
+{
+  // if the sync GPU callback is suspended, wake it up.
+  if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread ||
+      SConfig::GetInstance().bSyncGPU)
+  {
+    if (s_syncing_suspended)
+    {
+      s_syncing_suspended = false;
+      CoreTiming::ScheduleEvent(GPU_TIME_SLOT_SIZE, s_event_sync_gpu, GPU_TIME_SLOT_SIZE);
+    }
+  }
+}
+
 void RunGpu()
 {
   const SConfig& param = SConfig::GetInstance();
 
   // wake up GPU thread
-  if (param.bCPUThread && !s_use_deterministic_gpu_thread)
+  // In deterministic mode the GPU thread only needs this for AsyncRequests, as RunGpuOnCpu
+  // wakes it for new data. Without adaptive handoff it busy loops and doesn't need it at all.
+  if (param.bCPUThread && (!s_use_deterministic_gpu_thread || s_adaptive_handoff))
   {
+    s_handoff_pending.store(false);
     s_gpu_mainloop.Wakeup();
   }
 
-  // if the sync GPU callback is suspended, wake it up.
-  if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread ||
-      SConfig::GetInstance().bSyncGPU)
+  ResumeSyncGPUCallback();
+}
+
+void RunGpuBatched()
+{
+  if (s_adaptive_handoff)
   {
-    if (s_syncing_suspended)
+    // RunGpuOnCpu batches the handoff itself.
+    if (s_use_deterministic_gpu_thread)
     {
-      s_syncing_suspended = false;
-      CoreTiming::ScheduleEvent(GPU_TIME_SLOT_SIZE, s_event_sync_gpu, GPU_TIME_SLOT_SIZE);
+      ResumeSyncGPUCallback();
+      return;
+    }
+
+    // With SyncGPU, WaitForGpuThread already holds the GPU thread back until the CPU is far
+    // enough ahead. Otherwise, only wake a sleeping GPU thread once a batch has been queued, as
+    // waking it costs far more than handing it a few more bytes.
+    if (!SConfig::GetInstance().bSyncGPU && s_gpu_mainloop.IsSleeping() &&
+        CommandProcessor::fifo.CPReadWriteDistance < HANDOFF_BATCH_SIZE)
+    {
+      if (!s_handoff_pending.exchange(true))
+        CoreTiming::ScheduleEvent(HANDOFF_LATENCY_BUDGET, s_event_flush_handoff);
+      return;
     }
   }
+
+  RunGpu();
 }
 
 static int RunGpuOnCpu(int ticks)
 {
   CommandProcessor::SCPFifoStruct& fifo = CommandProcessor::fifo;
   bool reset_simd_state = false;
+  u32 unsignaled_bytes = 0;
   int available_ticks = int(ticks * SConfig::GetInstance().fSyncGpuOverclock) + s_sync_ticks.load();
   while (fifo.bFF_GPReadEnable && fifo.CPReadWriteDistance && !AtBreakpoint() &&
          available_ticks >= 0)
@@ -448,7 +538,17 @@ static int RunGpuOnCpu(int ticks)
     if (s_use_deterministic_gpu_thread)
     {
       ReadDataFromFifoOnCPU(fifo.CPReadPointer);
-      s_gpu_mainloop.Wakeup();
+      unsignaled_bytes += 32;
+      if (s_adaptive_handoff && unsignaled_bytes < HANDOFF_BATCH_SIZE)
+      {
+        s_handoff_pending.store(true);
+      }
+      else
+      {
+        s_handoff_pending.store(false);
+        s_gpu_mainloop.Wakeup();
+        unsignaled_bytes = 0;
+      }
     }
     else
     {
@@ -475,6 +575,9 @@ static int RunGpuOnCpu(int ticks)
 
   CommandProcessor::SetCPStatusFromGPU();
 
+  // Hand off the rest of the batch, as this is the last chance before the next time slot.
+  FlushHandoff();
+
   if (reset_simd_state)
   {
     FPURoundMode::LoadSIMDState();
@@ -556,7 +659,12 @@ static int WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= param.iSyncGpuMaxDistance)
+  {
+    StageTimers::ScopedTimer stage_timer(StageTimers::Stage::SyncGPUWait);
+    const auto start = std::chrono::steady_clock::now();
     s_sync_wakeup_event.Wait();
+    RecordSyncStall(start);
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -580,10 +688,22 @@ static void SyncGPUCallback(u64 ticks, s64 cyclesLate)
     CoreTiming::ScheduleEvent(next, s_event_sync_gpu, next);
 }
 
+static void FlushHandoffCallback(u64 userdata, s64 cyclesLate)
+{
+  FlushHandoff();
+}
+
 // Initialize GPU - CPU thread syncing, this gives us a deterministic way to start the GPU thread.
 void Prepare()
 {
   s_event_sync_gpu = CoreTiming::RegisterEvent("SyncGPUCallback", SyncGPUCallback);
+  s_event_flush_handoff = CoreTiming::RegisterEvent("FlushGPUHandoff", FlushHandoffCallback);
   s_syncing_suspended = true;
 }
+
+HandoffStats GetHandoffStats()
+{
+  return {s_gpu_mainloop.GetWakeupCount() - s_initial_gpu_wakeups, s_num_sync_stalls.load(),
+          std::chrono::nanoseconds(s_blocked_time_ns.load()), s_gpu_mainloop.GetSpinTime()};
+}
 }  // namespace Fifo
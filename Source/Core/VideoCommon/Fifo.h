@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include "Common/CommonTypes.h"
 
@@ -38,6 +39,9 @@ void* PopFifoAuxBuffer(size_t size);
 
 void FlushGpu();
 void RunGpu();
+// Like RunGpu, but with adaptive GPU handoff enabled, a sleeping GPU thread is only woken once
+// enough data is queued or the latency budget has passed. Used for gather pipe writes.
+void RunGpuBatched();
 void GpuMaySleep();
 void RunGpuLoop();
 void ExitGpuLoop();
@@ -45,4 +49,17 @@ void EmulatorState(bool running);
 bool AtBreakpoint();
 void ResetVideoBuffer();
 
+// Counters for the CPU/GPU thread handoff in dual core mode, since emulation started.
+struct HandoffStats
+{
+  // Times the GPU thread had to be woken from sleep.
+  u64 gpu_wakeups;
+  // Times the CPU thread blocked waiting for the GPU thread, and for how long in total.
+  u64 sync_stalls;
+  std::chrono::nanoseconds blocked_time;
+  // Current spin time of the GPU thread before sleeping, in adaptive handoff mode.
+  std::chrono::nanoseconds spin_time;
+};
+HandoffStats GetHandoffStats();
+
 }  // namespace Fifo
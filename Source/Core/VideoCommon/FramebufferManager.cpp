@@ -4,6 +4,7 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "Common/ChunkFile.h"
@@ -18,6 +19,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -383,8 +385,17 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
     y = EFB_HEIGHT - 1 - y;
 
   u32 tile_index;
-  if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
+  if (IsEFBCacheTilePresent(false, x, y, &tile_index) ||
+      UsePredictedEFBCacheTile(false, tile_index))
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_hits);
+  }
+  else
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_misses);
     PopulateEFBCache(false, tile_index);
+  }
+  m_efb_color_cache.accessed_tiles[tile_index] = true;
 
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
@@ -398,8 +409,16 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
     y = EFB_HEIGHT - 1 - y;
 
   u32 tile_index;
-  if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
+  if (IsEFBCacheTilePresent(true, x, y, &tile_index) || UsePredictedEFBCacheTile(true, tile_index))
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_hits);
+  }
+  else
+  {
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_misses);
     PopulateEFBCache(true, tile_index);
+  }
+  m_efb_depth_cache.accessed_tiles[tile_index] = true;
 
   float value;
   m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
@@ -436,6 +455,15 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
     m_efb_depth_cache.valid = false;
     m_efb_depth_cache.out_of_date = false;
   }
+
+  // Predicted tiles only expire with age, unless the EFB contents were replaced entirely.
+  if (forced)
+  {
+    std::fill(m_efb_color_cache.predicted_frames.begin(),
+              m_efb_color_cache.predicted_frames.end(), 0);
+    std::fill(m_efb_depth_cache.predicted_frames.begin(),
+              m_efb_depth_cache.predicted_frames.end(), 0);
+  }
 }
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
@@ -445,8 +473,64 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
   if (m_efb_depth_cache.valid)
     m_efb_depth_cache.out_of_date = true;
 
+  // Drawing doesn't expire the predicted tiles, which are allowed to be a few frames stale.
   if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
-    InvalidatePeekCache();
+    InvalidatePeekCache(false);
+}
+
+void FramebufferManager::ReadbackAccessedEFBTiles()
+{
+  const u64 frame = m_efb_cache_frame++;
+  for (const bool depth : {false, true})
+  {
+    EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+    if (!g_ActiveConfig.bEFBAccessPredictiveReadback)
+    {
+      std::fill(data.accessed_tiles.begin(), data.accessed_tiles.end(), false);
+      continue;
+    }
+
+    for (u32 tile_index = 0; tile_index < data.accessed_tiles.size(); tile_index++)
+    {
+      if (!data.accessed_tiles[tile_index])
+        continue;
+
+      // Pokes must land in the EFB before it is copied.
+      FlushEFBPokes();
+      CopyEFBCacheTile(depth, tile_index);
+      data.accessed_tiles[tile_index] = false;
+      data.predicted_frames[tile_index] = frame;
+      data.readback_pending = true;
+
+      // The copy overwrites the tile in the readback texture, so it can't be read until the copy
+      // is waited for in UsePredictedEFBCacheTile().
+      if (IsUsingTiledEFBCache())
+        data.tiles[tile_index] = false;
+      else
+        data.valid = false;
+    }
+  }
+}
+
+bool FramebufferManager::UsePredictedEFBCacheTile(bool depth, u32 tile_index)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  if (!g_ActiveConfig.bEFBAccessPredictiveReadback)
+    return false;
+
+  const u64 predicted_frame = data.predicted_frames[tile_index];
+  const u64 max_age = static_cast<u64>(std::max(g_ActiveConfig.iEFBAccessMaxStaleFrames, 1));
+  if (predicted_frame == 0 || m_efb_cache_frame - predicted_frame > max_age)
+    return false;
+
+  // The copies were submitted with the previous frame, so this rarely has to wait.
+  if (data.readback_pending)
+  {
+    data.readback_texture->Flush();
+    data.readback_pending = false;
+  }
+
+  return true;
 }
 
 bool FramebufferManager::CompileReadbackPipelines()
@@ -569,6 +653,14 @@ bool FramebufferManager::CreateReadbackFramebuffer()
     m_efb_cache_tiles_wide = tiles_wide;
   }
 
+  const size_t num_tiles = IsUsingTiledEFBCache() ? m_efb_color_cache.tiles.size() : 1;
+  for (EFBCacheData* data : {&m_efb_color_cache, &m_efb_depth_cache})
+  {
+    data->accessed_tiles.assign(num_tiles, false);
+    data->predicted_frames.assign(num_tiles, 0);
+    data->readback_pending = false;
+  }
+
   return true;
 }
 
@@ -584,10 +676,8 @@ void FramebufferManager::DestroyReadbackFramebuffer()
   DestroyCache(m_efb_depth_cache);
 }
 
-void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
+void FramebufferManager::CopyEFBCacheTile(bool depth, u32 tile_index)
 {
-  g_vertex_manager->OnCPUEFBAccess();
-
   // Force the path through the intermediate texture, as we can't do an image copy from a depth
   // buffer directly to a staging texture (must be the whole resource).
   const bool force_intermediate_copy =
@@ -641,9 +731,17 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
   {
     data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
+}
 
-  // Wait until the copy is complete.
+void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
+{
+  g_vertex_manager->OnCPUEFBAccess();
+  CopyEFBCacheTile(depth, tile_index);
+
+  // Wait until the copy is complete. This also completes any predictive copies.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
   data.readback_texture->Flush();
+  data.readback_pending = false;
   data.valid = true;
   data.out_of_date = false;
   if (IsUsingTiledEFBCache())
@@ -750,7 +848,8 @@ void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
 
   // Update the peek cache if it's valid, since we know the color of the pixel now.
   u32 tile_index;
-  if (IsEFBCacheTilePresent(false, x, y, &tile_index))
+  if (IsEFBCacheTilePresent(false, x, y, &tile_index) ||
+      UsePredictedEFBCacheTile(false, tile_index))
     m_efb_color_cache.readback_texture->WriteTexel(x, y, &color);
 }
 
@@ -768,7 +867,7 @@ void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
 
   // Update the peek cache if it's valid, since we know the color of the pixel now.
   u32 tile_index;
-  if (IsEFBCacheTilePresent(true, x, y, &tile_index))
+  if (IsEFBCacheTilePresent(true, x, y, &tile_index) || UsePredictedEFBCacheTile(true, tile_index))
     m_efb_depth_cache.readback_texture->WriteTexel(x, y, &depth);
 }
 
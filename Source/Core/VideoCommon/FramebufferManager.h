@@ -93,6 +93,11 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void FlagPeekCacheAsOutOfDate();
 
+  // Called at the end of each frame, before presenting. With predictive readback enabled, starts
+  // reading back the tiles the CPU accessed during the frame, without waiting for the copies.
+  // Peeks in the following frames are served from these copies while they are recent enough.
+  void ReadbackAccessedEFBTiles();
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -118,8 +123,14 @@ protected:
     std::unique_ptr<AbstractStagingTexture> readback_texture;
     std::unique_ptr<AbstractPipeline> copy_pipeline;
     std::vector<bool> tiles;
+    // Tiles accessed by the CPU during the current frame. One entry if not using tiles.
+    std::vector<bool> accessed_tiles;
+    // Frame in which each tile was last read back ahead of time, or zero if it never was.
+    std::vector<u64> predicted_frames;
     bool out_of_date;
     bool valid;
+    // Whether the readback texture has predictive copies which have not been waited for.
+    bool readback_pending;
   };
 
   bool CreateEFBFramebuffer();
@@ -143,6 +154,8 @@ protected:
   bool IsUsingTiledEFBCache() const;
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
+  bool UsePredictedEFBCacheTile(bool depth, u32 tile_index);
+  void CopyEFBCacheTile(bool depth, u32 tile_index);
   void PopulateEFBCache(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
@@ -176,6 +189,8 @@ protected:
   u32 m_efb_cache_tiles_wide = 0;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  // Incremented by ReadbackAccessedEFBTiles(), starting from one.
+  u64 m_efb_cache_frame = 1;
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
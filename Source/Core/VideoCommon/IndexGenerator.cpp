@@ -9,6 +9,7 @@
 #include <cstring>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoConfig.h"
@@ -17,6 +18,199 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// The common primitive types expand into a pattern of indices which repeats every few
+// primitives, shifted by the number of vertices consumed. The expansion loops below write whole
+// repetitions of the pattern with vector adds, and finish the remaining primitives one by one.
+template <size_t N>
+struct IndexPattern
+{
+  // Indices of the first repetition, relative to the first vertex. Primitive restart lanes are
+  // s_primitive_restart.
+  std::array<u16, N> first{};
+  // Added to each lane for every following repetition. Zero for primitive restart lanes and for
+  // the center of fans.
+  std::array<u16, N> step{};
+};
+
+template <size_t N>
+u16* WriteIndexPattern(u16* index_ptr, const IndexPattern<N>& pattern, u32 index,
+                       u32 repetitions)
+{
+  static_assert(N % 8 == 0, "Patterns must fill whole vectors");
+  if (repetitions == 0)
+    return index_ptr;
+
+  std::array<u16, N> current;
+  for (size_t i = 0; i < N; i++)
+  {
+    current[i] = pattern.first[i] == s_primitive_restart ? s_primitive_restart :
+                                                           static_cast<u16>(pattern.first[i] + index);
+  }
+
+#ifdef _M_X86
+  constexpr size_t num_vectors = N / 8;
+  __m128i current_vec[num_vectors];
+  __m128i step_vec[num_vectors];
+  for (size_t i = 0; i < num_vectors; i++)
+  {
+    current_vec[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&current[i * 8]));
+    step_vec[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.step[i * 8]));
+  }
+
+  for (u32 r = 0; r < repetitions; r++)
+  {
+    for (size_t i = 0; i < num_vectors; i++)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr + i * 8), current_vec[i]);
+      current_vec[i] = _mm_add_epi16(current_vec[i], step_vec[i]);
+    }
+    index_ptr += N;
+  }
+#else
+  for (u32 r = 0; r < repetitions; r++)
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      index_ptr[i] = current[i];
+      current[i] += pattern.step[i];
+    }
+    index_ptr += N;
+  }
+#endif
+
+  return index_ptr;
+}
+
+// 8 triangles.
+constexpr IndexPattern<24> MakeListPattern()
+{
+  IndexPattern<24> pattern;
+  for (u16 i = 0; i < 24; i++)
+  {
+    pattern.first[i] = i;
+    pattern.step[i] = 24;
+  }
+  return pattern;
+}
+
+// 2 triangles, each followed by a restart.
+constexpr IndexPattern<8> MakeListRestartPattern()
+{
+  IndexPattern<8> pattern;
+  for (u16 t = 0; t < 2; t++)
+  {
+    for (u16 v = 0; v < 3; v++)
+    {
+      pattern.first[t * 4 + v] = t * 3 + v;
+      pattern.step[t * 4 + v] = 6;
+    }
+    pattern.first[t * 4 + 3] = s_primitive_restart;
+  }
+  return pattern;
+}
+
+// 8 triangles, alternating the winding.
+constexpr IndexPattern<24> MakeStripPattern()
+{
+  IndexPattern<24> pattern;
+  for (u16 t = 0; t < 8; t++)
+  {
+    const bool wind = t % 2 != 0;
+    pattern.first[t * 3 + 0] = t;
+    pattern.first[t * 3 + 1] = t + 2 - !wind;
+    pattern.first[t * 3 + 2] = t + 2 - wind;
+    for (u16 v = 0; v < 3; v++)
+      pattern.step[t * 3 + v] = 8;
+  }
+  return pattern;
+}
+
+// 8 vertices of a strip, as is.
+constexpr IndexPattern<8> MakeSequencePattern()
+{
+  IndexPattern<8> pattern;
+  for (u16 i = 0; i < 8; i++)
+  {
+    pattern.first[i] = i;
+    pattern.step[i] = 8;
+  }
+  return pattern;
+}
+
+// 8 triangles around the center vertex.
+constexpr IndexPattern<24> MakeFanPattern()
+{
+  IndexPattern<24> pattern;
+  for (u16 t = 0; t < 8; t++)
+  {
+    pattern.first[t * 3 + 0] = 0;
+    pattern.first[t * 3 + 1] = t + 1;
+    pattern.first[t * 3 + 2] = t + 2;
+    pattern.step[t * 3 + 1] = 8;
+    pattern.step[t * 3 + 2] = 8;
+  }
+  return pattern;
+}
+
+// 4 strips of 3 triangles around the center vertex, see AddFan.
+constexpr IndexPattern<24> MakeFanRestartPattern()
+{
+  IndexPattern<24> pattern;
+  for (u16 g = 0; g < 4; g++)
+  {
+    const u16 i = 2 + g * 3;
+    const u16 first[] = {u16(i - 1), i, 0, u16(i + 1), u16(i + 2), s_primitive_restart};
+    for (u16 v = 0; v < 6; v++)
+    {
+      pattern.first[g * 6 + v] = first[v];
+      pattern.step[g * 6 + v] = (first[v] == 0 || first[v] == s_primitive_restart) ? 0 : 12;
+    }
+  }
+  return pattern;
+}
+
+// 4 quads as two triangles each.
+constexpr IndexPattern<24> MakeQuadPattern()
+{
+  IndexPattern<24> pattern;
+  for (u16 q = 0; q < 4; q++)
+  {
+    const u16 first[] = {0, 1, 2, 0, 2, 3};
+    for (u16 v = 0; v < 6; v++)
+    {
+      pattern.first[q * 6 + v] = q * 4 + first[v];
+      pattern.step[q * 6 + v] = 16;
+    }
+  }
+  return pattern;
+}
+
+// 8 quads as strips of two triangles each.
+constexpr IndexPattern<40> MakeQuadRestartPattern()
+{
+  IndexPattern<40> pattern;
+  for (u16 q = 0; q < 8; q++)
+  {
+    const u16 first[] = {1, 2, 0, 3};
+    for (u16 v = 0; v < 4; v++)
+    {
+      pattern.first[q * 5 + v] = q * 4 + first[v];
+      pattern.step[q * 5 + v] = 32;
+    }
+    pattern.first[q * 5 + 4] = s_primitive_restart;
+  }
+  return pattern;
+}
+
+constexpr IndexPattern<24> s_list_pattern = MakeListPattern();
+constexpr IndexPattern<8> s_list_restart_pattern = MakeListRestartPattern();
+constexpr IndexPattern<24> s_strip_pattern = MakeStripPattern();
+constexpr IndexPattern<8> s_sequence_pattern = MakeSequencePattern();
+constexpr IndexPattern<24> s_fan_pattern = MakeFanPattern();
+constexpr IndexPattern<24> s_fan_restart_pattern = MakeFanRestartPattern();
+constexpr IndexPattern<24> s_quad_pattern = MakeQuadPattern();
+constexpr IndexPattern<40> s_quad_restart_pattern = MakeQuadRestartPattern();
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -31,7 +225,21 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  u32 i = 2;
+  if constexpr (pr)
+  {
+    const u32 repetitions = num_verts / 6;
+    index_ptr = WriteIndexPattern(index_ptr, s_list_restart_pattern, index, repetitions);
+    i += repetitions * 6;
+  }
+  else
+  {
+    const u32 repetitions = num_verts / 24;
+    index_ptr = WriteIndexPattern(index_ptr, s_list_pattern, index, repetitions);
+    i += repetitions * 24;
+  }
+
+  for (; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -43,7 +251,9 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 repetitions = num_verts / 8;
+    index_ptr = WriteIndexPattern(index_ptr, s_sequence_pattern, index, repetitions);
+    for (u32 i = repetitions * 8; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -51,8 +261,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // The pattern covers an even number of triangles, so the winding starts over afterwards.
+    const u32 repetitions = num_verts >= 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WriteIndexPattern(index_ptr, s_strip_pattern, index, repetitions);
+
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + repetitions * 8; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -88,6 +302,10 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    const u32 repetitions = num_verts >= 2 ? (num_verts - 2) / 12 : 0;
+    index_ptr = WriteIndexPattern(index_ptr, s_fan_restart_pattern, index, repetitions);
+    i += repetitions * 12;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -107,6 +325,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    const u32 repetitions = num_verts >= 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WriteIndexPattern(index_ptr, s_fan_pattern, index, repetitions);
+    i += repetitions * 8;
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -136,6 +360,19 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+  if constexpr (pr)
+  {
+    const u32 repetitions = num_verts / 32;
+    index_ptr = WriteIndexPattern(index_ptr, s_quad_restart_pattern, index, repetitions);
+    i += repetitions * 32;
+  }
+  else
+  {
+    const u32 repetitions = num_verts / 16;
+    index_ptr = WriteIndexPattern(index_ptr, s_quad_pattern, index, repetitions);
+    i += repetitions * 16;
+  }
+
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -76,6 +76,7 @@
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -139,12 +140,18 @@ void Renderer::Shutdown()
   // can require additional graphics sub-systems so it needs to be done first
   ShutdownFrameDumping();
   ShutdownImGui();
+
+  if (m_stage_timers_enabled)
+  {
+    StageTimers::Disable();
+    m_stage_timers_enabled = false;
+  }
   m_post_processor.reset();
 }
 
 void Renderer::BeginUtilityDrawing()
 {
-  g_vertex_manager->Flush();
+  g_vertex_manager->Flush(FlushReason::Renderer);
 }
 
 void Renderer::EndUtilityDrawing()
@@ -415,6 +422,7 @@ void Renderer::CheckForConfigChanges()
 
   // Update texture cache settings with any changed options.
   g_texture_cache->OnConfigChanged(g_ActiveConfig);
+  VertexLoaderManager::UpdateWorkerThreads();
 
   // EFB tile cache doesn't need to notify the backend.
   if (old_efb_access_tile_size != g_ActiveConfig.iEFBAccessTileSize)
@@ -566,6 +574,9 @@ void Renderer::DrawDebugText()
   if (g_ActiveConfig.bOverlayProjStats)
     g_stats.DisplayProj();
 
+  if (g_ActiveConfig.bOverlayStageTimes)
+    g_stats.DisplayStageTimes();
+
   const std::string profile_output = Common::Profiler::ToString();
   if (!profile_output.empty())
     ImGui::TextUnformatted(profile_output.c_str());
@@ -1257,6 +1268,12 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       // with the loader, and it has not been unmapped yet. Force a pipeline flush to avoid this.
       //g_vertex_manager->Flush();
 
+      // Start reading back the EFB tiles accessed this frame, so the copies are submitted along
+      // with the frame. The readback has to include the draws still batched in the vertex manager.
+      if (g_ActiveConfig.bEFBAccessPredictiveReadback)
+        g_vertex_manager->Flush(FlushReason::Renderer);
+      g_framebuffer_manager->ReadbackAccessedEFBTiles();
+
       // Render any UI elements to the draw list.
       {
         auto lock = GetImGuiLock();
@@ -1294,6 +1311,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
         // Present to the window system.
         {
+          StageTimers::ScopedTimer stage_timer(StageTimers::Stage::Present);
           std::lock_guard<std::mutex> guard(m_swap_mutex);
           PresentBackbuffer();
         }
@@ -1306,6 +1324,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       if (!is_duplicate_frame)
       {
         m_fps_counter.Update();
+        UpdateStageTimes();
 
         if (IsFrameDumping())
           DumpCurrentFrame(xfb_entry->texture.get(), xfb_rect, ticks);
@@ -1401,7 +1420,11 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       // Since we use the common pipelines here and draw vertices if a batch is currently being
       // built by the vertex loader, we end up trampling over its pointer, as we share the buffer
       // with the loader, and it has not been unmapped yet. Force a pipeline flush to avoid this.
-      g_vertex_manager->Flush();
+      g_vertex_manager->Flush(FlushReason::Renderer);
+
+      // Start reading back the EFB tiles accessed this frame, so the copies are submitted along
+      // with the frame.
+      g_framebuffer_manager->ReadbackAccessedEFBTiles();
 
       // Render any UI elements to the draw list.
       {
@@ -1439,6 +1462,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
         // Present to the window system.
         {
+          StageTimers::ScopedTimer stage_timer(StageTimers::Stage::Present);
           std::lock_guard<std::mutex> guard(m_swap_mutex);
           PresentBackbuffer();
         }
@@ -1451,6 +1475,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       if (!is_duplicate_frame)
       {
         m_fps_counter.Update();
+        UpdateStageTimes();
 
         DolphinAnalytics::PerformanceSample perf_sample;
         perf_sample.speed_ratio = SystemTimers::GetEstimatedEmulationPerformance();
@@ -1537,6 +1562,64 @@ void Renderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
   }
 }
 
+void Renderer::UpdateStageTimes()
+{
+  const bool enabled = g_ActiveConfig.bOverlayStageTimes || g_ActiveConfig.bLogStageTimesToFile;
+  const auto now = std::chrono::steady_clock::now();
+  if (enabled != m_stage_timers_enabled)
+  {
+    if (enabled)
+      StageTimers::Enable();
+    else
+      StageTimers::Disable();
+    m_stage_timers_enabled = enabled;
+
+    // The first frame starts now, without the time from before the timers were enabled.
+    m_frame_stage_times.Take();
+    m_last_frame_end = now;
+    return;
+  }
+
+  if (!enabled)
+  {
+    if (m_stage_times_file.is_open())
+      m_stage_times_file.close();
+    return;
+  }
+
+  g_stats.frame_time = now - m_last_frame_end;
+  g_stats.frame_stage_times = m_frame_stage_times.Take();
+  m_last_frame_end = now;
+
+  if (g_ActiveConfig.bLogStageTimesToFile)
+    LogStageTimesToFile();
+  else if (m_stage_times_file.is_open())
+    m_stage_times_file.close();
+}
+
+void Renderer::LogStageTimesToFile()
+{
+  if (!m_stage_times_file.is_open())
+  {
+    File::OpenFStream(m_stage_times_file, File::GetUserPath(D_LOGS_IDX) + "stage_times.csv",
+                      std::ios_base::out);
+    m_stage_times_file << "frame,frame_us";
+    for (size_t i = 0; i < StageTimers::NUM_STAGES; i++)
+    {
+      const auto stage = static_cast<StageTimers::Stage>(i);
+      m_stage_times_file << ',' << StageTimers::GetStageColumnName(stage) << "_us";
+    }
+    m_stage_times_file << '\n';
+  }
+
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  m_stage_times_file << fmt::format("{},{:.1f}", m_frame_count,
+                                    Microseconds(g_stats.frame_time).count());
+  for (const std::chrono::nanoseconds time : g_stats.frame_stage_times)
+    m_stage_times_file << fmt::format(",{:.1f}", Microseconds(time).count());
+  m_stage_times_file << '\n';
+}
+
 bool Renderer::IsFrameDumping() const
 {
   if (m_screenshot_request.IsSet())
@@ -1551,6 +1634,7 @@ bool Renderer::IsFrameDumping() const
 void Renderer::DumpCurrentFrame(const AbstractTexture* src_texture,
                                 const MathUtil::Rectangle<int>& src_rect, u64 ticks)
 {
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::FrameDump);
   int source_width = src_rect.GetWidth();
   int source_height = src_rect.GetHeight();
   int target_width, target_height;
@@ -1634,6 +1718,8 @@ void Renderer::FlushFrameDump()
   if (!m_frame_dump_needs_flush)
     return;
 
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::FrameDump);
+
   // Ensure dumping thread is done with output texture before swapping.
   FinishFrameData();
 
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <fstream>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -32,6 +34,7 @@
 #include "VideoCommon/FPSCounter.h"
 #include "VideoCommon/FrameDump.h"
 #include "VideoCommon/RenderState.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/TextureConfig.h"
 
 class AbstractFramebuffer;
@@ -423,6 +426,15 @@ private:
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
 
+  // Collects the stage times of the frame that just ended, for the overlay and the log.
+  void UpdateStageTimes();
+  void LogStageTimesToFile();
+
+  bool m_stage_timers_enabled = false;
+  StageTimers::Interval m_frame_stage_times;
+  std::chrono::steady_clock::time_point m_last_frame_end;
+  std::ofstream m_stage_times_file;
+
   std::unique_ptr<NetPlayChatUI> m_netplay_chat_ui;
 
   Common::Flag m_force_reload_textures;
@@ -4,6 +4,8 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
@@ -48,6 +50,7 @@ bool ShaderCache::Initialize()
 void ShaderCache::InitializeShaderCache()
 {
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
+  m_frame_number = 0;
 
   // Load shader and UID caches.
   if (g_ActiveConfig.bShaderCache && m_api_type != APIType::Nothing)
@@ -96,6 +99,11 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+
+  // This is called once per frame, so use it to move the pipeline lookahead window forward.
+  m_frame_number++;
+  QueueDeferredPipelines(false);
+  SETSTAT(g_stats.num_pending_shader_compiles, m_async_shader_compiler->GetPendingWorkCount());
 }
 
 void ShaderCache::Shutdown()
@@ -115,12 +123,15 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
     return it->second.first.get();
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  if (exists_in_cache)
+    m_deferred_pipeline_uids.erase(uid);
+
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_renderer->CreatePipeline(*pipeline_config);
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
-    AppendGXPipelineUID(uid);
+    AppendGXPipelineUID(uid, m_frame_number);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
@@ -132,11 +143,14 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
-    else
-      return {};
+
+    // A cached pipeline that has not been queued yet is needed now, so compile it next.
+    if (m_deferred_pipeline_uids.erase(uid))
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+    return {};
   }
 
-  AppendGXPipelineUID(uid);
+  AppendGXPipelineUID(uid, m_frame_number);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
   return {};
 }
@@ -369,6 +383,9 @@ void ShaderCache::LoadCaches()
 void ShaderCache::ClearCaches()
 {
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
+  m_deferred_pipelines.clear();
+  m_next_deferred_pipeline = 0;
+  m_deferred_pipeline_uids.clear();
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
   ClearShaderCache(m_ps_cache);
@@ -402,17 +419,64 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // All uids with a null pipeline need compiling. Rather than queueing them all at once, they
+  // are queued in the order the game first needed them, a window of frames at a time.
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    if (it.second.first || it.second.second)
+      continue;
+
+    const auto frame_it = m_gx_pipeline_first_use_frames.find(it.first);
+    const u32 first_use_frame =
+        frame_it != m_gx_pipeline_first_use_frames.end() ? frame_it->second : 0;
+    m_deferred_pipelines.emplace_back(first_use_frame, it.first);
+    m_deferred_pipeline_uids.insert(it.first);
+    it.second.second = true;
   }
+  std::stable_sort(m_deferred_pipelines.begin() + m_next_deferred_pipeline,
+                   m_deferred_pipelines.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
   for (auto& it : m_gx_uber_pipeline_cache)
   {
     if (!it.second.first)
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
+
+  QueueDeferredPipelines(g_ActiveConfig.bWaitForShadersBeforeStarting);
+}
+
+void ShaderCache::QueueDeferredPipelines(bool queue_all)
+{
+  if (m_next_deferred_pipeline == m_deferred_pipelines.size())
+    return;
+
+  // If the compiler has run out of work, move the window up to the next pipeline in the trace,
+  // rather than leaving the worker threads idle until the game catches up.
+  u32 window_end = m_frame_number + PIPELINE_LOOKAHEAD_FRAMES;
+  if (!m_async_shader_compiler->HasPendingWork())
+  {
+    window_end = std::max(window_end, m_deferred_pipelines[m_next_deferred_pipeline].first +
+                                          PIPELINE_LOOKAHEAD_FRAMES);
+  }
+
+  while (m_next_deferred_pipeline < m_deferred_pipelines.size())
+  {
+    const auto& [first_use_frame, uid] = m_deferred_pipelines[m_next_deferred_pipeline];
+    if (!queue_all && first_use_frame > window_end)
+      break;
+
+    // Pipelines which are no longer deferred were needed early, and compiled on demand.
+    if (m_deferred_pipeline_uids.erase(uid))
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE + first_use_frame);
+    m_next_deferred_pipeline++;
+  }
+
+  if (m_next_deferred_pipeline == m_deferred_pipelines.size())
+  {
+    m_deferred_pipelines.clear();
+    m_next_deferred_pipeline = 0;
+  }
 }
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
@@ -722,12 +786,40 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   return entry.first.get();
 }
 
+static std::vector<u32> ReadPipelineTrace(const std::string& filename, u32 magic)
+{
+  File::IOFile file(filename, "rb");
+  u32 existing_magic;
+  u32 existing_version;
+  if (!file.ReadBytes(&existing_magic, sizeof(existing_magic)) ||
+      !file.ReadBytes(&existing_version, sizeof(existing_version)) || existing_magic != magic ||
+      existing_version != GX_PIPELINE_UID_VERSION)
+  {
+    return {};
+  }
+
+  std::vector<u32> frames(static_cast<size_t>(file.GetSize() - file.Tell()) / sizeof(u32));
+  if (!file.ReadArray(frames.data(), frames.size()))
+    return {};
+  return frames;
+}
+
 void ShaderCache::LoadPipelineUIDCache()
 {
   constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
+  constexpr u32 TRACE_FILE_MAGIC = 0x43525450;  // PTRC
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  const std::string trace_filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidtrace";
+
+  // The trace has one frame number for each UID in the UID cache, in the same order. If it is
+  // missing or short (e.g. written by an older version), the remaining UIDs are assumed to have
+  // been needed at the same time as the last known one, which keeps them in file order.
+  const std::vector<u32> trace_frames = ReadPipelineTrace(trace_filename, TRACE_FILE_MAGIC);
+  std::vector<u32> loaded_frames;
+
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -748,13 +840,19 @@ void ShaderCache::LoadPipelineUIDCache()
       uid_file_valid = file_size == expected_size;
       if (uid_file_valid)
       {
+        loaded_frames.reserve(uid_count);
         for (size_t i = 0; i < uid_count; i++)
         {
           SerializedGXPipelineUid serialized_uid;
           if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
           {
+            const u32 first_use_frame = i < trace_frames.size() ? trace_frames[i] :
+                                        !trace_frames.empty() ? trace_frames.back() :
+                                                                0;
+
             // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
+            AddSerializedGXPipelineUID(serialized_uid, first_use_frame);
+            loaded_frames.push_back(first_use_frame);
           }
           else
           {
@@ -774,6 +872,15 @@ void ShaderCache::LoadPipelineUIDCache()
       m_gx_pipeline_uid_cache_file.Close();
   }
 
+  // The trace is small, so it is simply rewritten to match the UID cache every time.
+  if (m_gx_pipeline_trace_file.Open(trace_filename, "wb"))
+  {
+    m_gx_pipeline_trace_file.WriteBytes(&TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+    m_gx_pipeline_trace_file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION));
+    if (m_gx_pipeline_uid_cache_file.IsOpen())
+      m_gx_pipeline_trace_file.WriteArray(loaded_frames.data(), loaded_frames.size());
+  }
+
   // If the file is not open, it means it was either corrupted or didn't exist.
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
   {
@@ -788,7 +895,12 @@ void ShaderCache::LoadPipelineUIDCache()
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
       for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      {
+        const auto frame_it = m_gx_pipeline_first_use_frames.find(it.first);
+        AppendGXPipelineUID(it.first, frame_it != m_gx_pipeline_first_use_frames.end() ?
+                                          frame_it->second :
+                                          0);
+      }
     }
   }
 
@@ -799,12 +911,15 @@ void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
   m_gx_pipeline_uid_cache_file.Close();
+  m_gx_pipeline_trace_file.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid,
+                                             u32 first_use_frame)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
+  m_gx_pipeline_first_use_frames.emplace(real_uid, first_use_frame);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
@@ -815,7 +930,7 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   entry.second = false;
 }
 
-void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
+void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config, u32 first_use_frame)
 {
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
     return;
@@ -826,6 +941,16 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
     m_gx_pipeline_uid_cache_file.Close();
+    m_gx_pipeline_trace_file.Close();
+    return;
+  }
+
+  m_gx_pipeline_first_use_frames.emplace(config, first_use_frame);
+  if (m_gx_pipeline_trace_file.IsOpen() &&
+      !m_gx_pipeline_trace_file.WriteBytes(&first_use_frame, sizeof(first_use_frame)))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing pipeline trace failed, closing file.");
+    m_gx_pipeline_trace_file.Close();
   }
 }
 
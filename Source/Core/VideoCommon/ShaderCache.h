@@ -10,9 +10,11 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
@@ -122,6 +124,7 @@ private:
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
+  void QueueDeferredPipelines(bool queue_all);
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
 
@@ -158,8 +161,8 @@ private:
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
-  void AppendGXPipelineUID(const GXPipelineUid& config);
+  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid, u32 first_use_frame);
+  void AppendGXPipelineUID(const GXPipelineUid& config, u32 first_use_frame);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -184,6 +187,8 @@ private:
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
   // for as few frames as possible, otherwise we risk framerate drops.
+  // Pipelines from the shader cache are offset by the frame they were first used on, so the
+  // ones needed soonest after boot are compiled first.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
@@ -191,6 +196,10 @@ private:
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
 
+  // How many frames ahead of the current one cached pipelines are queued for compilation.
+  // Anything further out is only queued once the compiler runs out of work.
+  static constexpr u32 PIPELINE_LOOKAHEAD_FRAMES = 300;
+
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
@@ -229,6 +238,18 @@ private:
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
   LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
+
+  // Pipeline order trace: the frame on which each UID in the UID cache was first needed, stored
+  // alongside it in the same order.
+  File::IOFile m_gx_pipeline_trace_file;
+  std::map<GXPipelineUid, u32> m_gx_pipeline_first_use_frames;
+  u32 m_frame_number = 0;
+
+  // Cached pipelines which have not been queued yet, sorted by first use. These are flagged as
+  // pending in m_gx_pipeline_cache, and are only in m_deferred_pipeline_uids until queued.
+  std::vector<std::pair<u32, GXPipelineUid>> m_deferred_pipelines;
+  size_t m_next_deferred_pipeline = 0;
+  std::set<GXPipelineUid> m_deferred_pipeline_uids;
   LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
@@ -4,6 +4,8 @@
 
 #include "VideoCommon/ShaderGenCommon.h"
 
+#include <utility>
+
 #include <fmt/format.h>
 
 #include "Common/FileUtil.h"
@@ -11,6 +13,33 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
+constexpr size_t SHADER_CODE_INITIAL_CAPACITY = 16384;
+constexpr size_t MAX_POOLED_SHADER_CODE_BUFFERS = 4;
+static thread_local std::vector<std::string> s_shader_code_buffers;
+
+ShaderCode::ShaderCode()
+{
+  if (s_shader_code_buffers.empty())
+  {
+    m_buffer.reserve(SHADER_CODE_INITIAL_CAPACITY);
+    return;
+  }
+
+  m_buffer = std::move(s_shader_code_buffers.back());
+  s_shader_code_buffers.pop_back();
+  m_buffer.clear();
+}
+
+ShaderCode::~ShaderCode()
+{
+  // Moved-from objects have no buffer worth keeping.
+  if (m_buffer.capacity() >= SHADER_CODE_INITIAL_CAPACITY &&
+      s_shader_code_buffers.size() < MAX_POOLED_SHADER_CODE_BUFFERS)
+  {
+    s_shader_code_buffers.push_back(std::move(m_buffer));
+  }
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
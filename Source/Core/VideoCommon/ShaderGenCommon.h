@@ -97,10 +97,19 @@ private:
   uid_data data{};
 };
 
+// The buffer is taken from a per-thread pool of recycled buffers, and given back on destruction.
+// Buffers keep their capacity, so once a thread has generated a few shaders, generating more
+// does not need to allocate for the output.
 class ShaderCode : public ShaderGeneratorInterface
 {
 public:
-  ShaderCode() { m_buffer.reserve(16384); }
+  ShaderCode();
+  ~ShaderCode();
+  ShaderCode(const ShaderCode&) = default;
+  ShaderCode(ShaderCode&&) = default;
+  ShaderCode& operator=(const ShaderCode&) = default;
+  ShaderCode& operator=(ShaderCode&&) = default;
+
   const std::string& GetBuffer() const { return m_buffer; }
 
   // Writes format strings using fmtlib format strings.
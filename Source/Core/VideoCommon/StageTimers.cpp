@@ -0,0 +1,181 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/StageTimers.h"
+
+#include <atomic>
+#include <mutex>
+
+#include "Common/Intrinsics.h"
+
+namespace StageTimers
+{
+using Clock = std::chrono::steady_clock;
+
+static std::mutex s_enable_lock;
+static u32 s_num_users = 0;
+static std::atomic_bool s_enabled{false};
+// Incremented each time the timers are enabled, to ignore start times from an earlier run.
+static std::atomic<u32> s_generation{0};
+
+static std::array<std::atomic<u64>, NUM_STAGES> s_stage_ticks{};
+
+// Conversion from ticks to nanoseconds, measured when the timers are first enabled.
+static double s_ns_per_tick = 1.0;
+static std::once_flag s_calibrated;
+
+#ifdef _M_X86
+static u64 GetTicks()
+{
+  return __rdtsc();
+}
+
+static void Calibrate()
+{
+  // The TSC runs at a constant rate on every CPU that is fast enough to run Dolphin.
+  constexpr auto calibration_time = std::chrono::milliseconds(2);
+  const Clock::time_point start_time = Clock::now();
+  const u64 start_ticks = GetTicks();
+  Clock::time_point end_time;
+  do
+  {
+    end_time = Clock::now();
+  } while (end_time - start_time < calibration_time);
+  const u64 end_ticks = GetTicks();
+
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time);
+  s_ns_per_tick = static_cast<double>(elapsed.count()) / (end_ticks - start_ticks);
+}
+#else
+static u64 GetTicks()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+      .count();
+}
+
+static void Calibrate()
+{
+}
+#endif
+
+const char* GetStageName(Stage stage)
+{
+  static constexpr std::array<const char*, NUM_STAGES> names{{
+      "CPU emulation",
+      "SyncGPU wait",
+      "Opcode decode",
+      "Vertex load",
+      "Texture cache",
+      "Shader lookup",
+      "Backend submit",
+      "Present",
+      "Frame dump",
+  }};
+  return names[static_cast<size_t>(stage)];
+}
+
+const char* GetStageColumnName(Stage stage)
+{
+  static constexpr std::array<const char*, NUM_STAGES> names{{
+      "cpu_emulation",
+      "syncgpu_wait",
+      "opcode_decode",
+      "vertex_load",
+      "texture_cache",
+      "shader_lookup",
+      "backend_submit",
+      "present",
+      "frame_dump",
+  }};
+  return names[static_cast<size_t>(stage)];
+}
+
+void Enable()
+{
+  std::call_once(s_calibrated, Calibrate);
+
+  std::lock_guard<std::mutex> guard(s_enable_lock);
+  if (s_num_users++ == 0)
+  {
+    s_generation.fetch_add(1, std::memory_order_relaxed);
+    s_enabled.store(true, std::memory_order_relaxed);
+  }
+}
+
+void Disable()
+{
+  std::lock_guard<std::mutex> guard(s_enable_lock);
+  if (s_num_users != 0 && --s_num_users == 0)
+    s_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool IsEnabled()
+{
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+Durations GetTotalDurations()
+{
+  Durations durations;
+  for (size_t i = 0; i < NUM_STAGES; i++)
+  {
+    const u64 ticks = s_stage_ticks[i].load(std::memory_order_relaxed);
+    durations[i] = std::chrono::nanoseconds(static_cast<s64>(ticks * s_ns_per_tick));
+  }
+  return durations;
+}
+
+Durations Interval::Take()
+{
+  const Durations totals = GetTotalDurations();
+  Durations durations;
+  for (size_t i = 0; i < NUM_STAGES; i++)
+    durations[i] = totals[i] - m_last_totals[i];
+  m_last_totals = totals;
+  return durations;
+}
+
+#ifdef USE_STAGE_TIMERS
+// The innermost running stage on this thread, and when it was last (re)started.
+static thread_local Stage t_current_stage = Stage::NumStages;
+static thread_local u64 t_stage_start;
+static thread_local u32 t_stage_start_generation;
+
+// Charges the running stage of this thread, and starts a new interval at now.
+static void Charge(u64 now)
+{
+  const u32 generation = s_generation.load(std::memory_order_relaxed);
+  if (t_current_stage != Stage::NumStages && t_stage_start_generation == generation)
+  {
+    s_stage_ticks[static_cast<size_t>(t_current_stage)].fetch_add(now - t_stage_start,
+                                                                  std::memory_order_relaxed);
+  }
+
+  t_stage_start = now;
+  t_stage_start_generation = generation;
+}
+
+ScopedTimer::ScopedTimer(Stage stage) : m_outer_stage(t_current_stage)
+{
+  // The stage is tracked even while the timers are disabled, so that enabling them in the middle
+  // of a long-running stage still charges it.
+  if (s_enabled.load(std::memory_order_relaxed))
+    Charge(GetTicks());
+  t_current_stage = stage;
+}
+
+ScopedTimer::~ScopedTimer()
+{
+  if (s_enabled.load(std::memory_order_relaxed))
+    Charge(GetTicks());
+  t_current_stage = m_outer_stage;
+}
+
+void Checkpoint()
+{
+  if (s_enabled.load(std::memory_order_relaxed))
+    Charge(GetTicks());
+}
+#endif
+}  // namespace StageTimers
@@ -0,0 +1,101 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Measures how much wall time is spent in each stage of the emulated frame.
+// Timers nest: while an inner stage is running, time is charged to it rather than to the
+// enclosing stage, so the per-stage durations add up to the time spent in all timed scopes.
+// Time is measured with the TSC on x86, and with std::chrono::steady_clock elsewhere.
+// Disabled by default, in which case a timer costs a relaxed atomic load and a thread-local
+// store. Builds without USE_STAGE_TIMERS compile the timers out entirely.
+namespace StageTimers
+{
+enum class Stage : u32
+{
+  CPUEmulation,
+  SyncGPUWait,
+  OpcodeDecode,
+  VertexLoad,
+  TextureCache,
+  ShaderLookup,
+  BackendSubmit,
+  Present,
+  FrameDump,
+  NumStages
+};
+
+// Whether the timers were built in. Without them, every stage takes no time.
+#ifdef USE_STAGE_TIMERS
+constexpr bool AVAILABLE = true;
+#else
+constexpr bool AVAILABLE = false;
+#endif
+
+constexpr size_t NUM_STAGES = static_cast<size_t>(Stage::NumStages);
+using Durations = std::array<std::chrono::nanoseconds, NUM_STAGES>;
+
+const char* GetStageName(Stage stage);
+// Lowercase name without spaces, for CSV headers.
+const char* GetStageColumnName(Stage stage);
+
+// Calls nest; the timers run while at least one caller has them enabled.
+void Enable();
+void Disable();
+bool IsEnabled();
+
+// Returns the total time spent in each stage since the timers were first enabled.
+Durations GetTotalDurations();
+
+// Splits the totals into intervals, e.g. frames. Each user keeps its own Interval, so they don't
+// interfere with each other.
+class Interval
+{
+public:
+  // Returns the time spent in each stage since the previous call.
+  Durations Take();
+
+private:
+  Durations m_last_totals{};
+};
+
+#ifdef USE_STAGE_TIMERS
+class ScopedTimer final
+{
+public:
+  explicit ScopedTimer(Stage stage);
+  ~ScopedTimer();
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  // The stage that was running on this thread when the timer was started, if any.
+  Stage m_outer_stage;
+};
+
+// Charges the time spent in the running stage of this thread so far. Used by long-running
+// stages, like CPU emulation, so that their time shows up before the stage ends.
+void Checkpoint();
+#else
+class ScopedTimer final
+{
+public:
+  explicit ScopedTimer(Stage stage) {}
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+inline void Checkpoint()
+{
+}
+#endif
+}  // namespace StageTimers
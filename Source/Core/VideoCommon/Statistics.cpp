@@ -4,15 +4,28 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <algorithm>
+#include <chrono>
 #include <utility>
 
 #include <imgui.h>
 
+#include "Core/ConfigManager.h"
+
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
 Statistics g_stats;
 
+static constexpr std::array<const char*, static_cast<size_t>(FlushReason::Count)>
+    FLUSH_REASON_NAMES = {
+        "Flushes (BP reg)",     "Flushes (XF mem)",      "Flushes (XF reg)",
+        "Flushes (mtx index)",  "Flushes (vtx format)",  "Flushes (prim type)",
+        "Flushes (buffer full)", "Flushes (FIFO idle)",  "Flushes (async req)",
+        "Flushes (renderer)",   "Flushes (savestate)",
+};
+
 void Statistics::ResetFrame()
 {
   this_frame = {};
@@ -72,6 +85,13 @@ void Statistics::Display() const
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  for (size_t i = 0; i < this_frame.num_flushes.size(); i++)
+  {
+    draw_statistic(FLUSH_REASON_NAMES[i], "%d", this_frame.num_flushes[i]);
+  }
+  draw_statistic("Redundant state writes", "%d", this_frame.num_redundant_state_writes);
+  draw_statistic("Ubershader draws", "%d", this_frame.num_uber_shader_fallback_draws);
+  draw_statistic("Shader compiles queued", "%d", num_pending_shader_compiles);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -86,6 +106,21 @@ void Statistics::Display() const
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("EFB peek cache hits:", "%d", this_frame.num_efb_peek_cache_hits);
+  draw_statistic("EFB peek cache misses:", "%d", this_frame.num_efb_peek_cache_misses);
+  draw_statistic("EFB copies to RAM (deferred):", "%d", this_frame.num_efb_copies_to_ram_deferred);
+  draw_statistic("EFB copies to RAM (forced):", "%d", this_frame.num_efb_copies_to_ram_forced);
+  draw_statistic("EFB copies to RAM (discarded):", "%d",
+                 this_frame.num_efb_copies_to_ram_discarded);
+
+  const Fifo::HandoffStats handoff = Fifo::GetHandoffStats();
+  draw_statistic("GPU thread wakeups", "%llu",
+                 static_cast<unsigned long long>(handoff.gpu_wakeups));
+  draw_statistic("GPU sync stalls", "%llu", static_cast<unsigned long long>(handoff.sync_stalls));
+  draw_statistic("CPU blocked on GPU", "%.1f ms",
+                 std::chrono::duration<double, std::milli>(handoff.blocked_time).count());
+  draw_statistic("GPU thread spin", "%.1f us",
+                 std::chrono::duration<double, std::micro>(handoff.spin_time).count());
 
   ImGui::Columns(1);
 
@@ -122,3 +157,46 @@ void Statistics::DisplayProj() const
 
   ImGui::End();
 }
+
+void Statistics::DisplayStageTimes() const
+{
+  const float scale = ImGui::GetIO().DisplayFramebufferScale.x;
+  ImGui::SetNextWindowPos(ImVec2(295.0f * scale, 10.0f * scale), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSizeConstraints(ImVec2(300.0f * scale, 0.0f), ImGui::GetIO().DisplaySize);
+  if (!ImGui::Begin("Stage Timing", nullptr, ImGuiWindowFlags_NoNavInputs))
+  {
+    ImGui::End();
+    return;
+  }
+
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  const double frame_ms = Milliseconds(frame_time).count();
+
+  ImGui::Columns(3, "Stage Timing", true);
+  const auto draw_stage = [frame_ms](const char* name, std::chrono::nanoseconds time) {
+    const double ms = Milliseconds(time).count();
+    ImGui::TextUnformatted(name);
+    ImGui::NextColumn();
+    ImGui::Text("%.2f ms", ms);
+    ImGui::NextColumn();
+    ImGui::ProgressBar(frame_ms > 0.0 ? static_cast<float>(ms / frame_ms) : 0.0f);
+    ImGui::NextColumn();
+  };
+
+  draw_stage("Frame", frame_time);
+  std::chrono::nanoseconds timed{};
+  for (size_t i = 0; i < StageTimers::NUM_STAGES; i++)
+  {
+    draw_stage(StageTimers::GetStageName(static_cast<StageTimers::Stage>(i)),
+               frame_stage_times[i]);
+    timed += frame_stage_times[i];
+  }
+  // In dual core, the stages of the CPU thread and the GPU thread overlap, so their times can add
+  // up to more than the frame time, and the rest of the frame can't be attributed to either.
+  if (!SConfig::GetInstance().bCPUThread)
+    draw_stage("Other", std::max(frame_time - timed, std::chrono::nanoseconds::zero()));
+
+  ImGui::Columns(1);
+
+  ImGui::End();
+}
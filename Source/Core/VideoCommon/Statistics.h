@@ -5,6 +5,27 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <cstddef>
+
+#include "VideoCommon/StageTimers.h"
+
+// Why VertexManagerBase::Flush was called, counted when it actually draws.
+enum class FlushReason
+{
+  BPRegister,
+  XFMemory,
+  XFRegister,
+  MatrixIndex,
+  VertexFormat,
+  PrimitiveType,
+  BufferFull,
+  FifoIdle,
+  AsyncRequest,
+  Renderer,
+  SaveState,
+  Count
+};
 
 struct Statistics
 {
@@ -19,6 +40,8 @@ struct Statistics
 
   int num_vertex_loaders;
 
+  int num_pending_shader_compiles;
+
   std::array<float, 6> proj;
   std::array<float, 16> gproj;
   std::array<float, 16> g2proj;
@@ -39,6 +62,7 @@ struct Statistics
 
     int num_primitive_joins;
     int num_draw_calls;
+    int num_uber_shader_fallback_draws;
 
     int num_dlists_called;
 
@@ -59,12 +83,34 @@ struct Statistics
 
     int num_efb_peeks;
     int num_efb_pokes;
+    // EFB peeks answered from the peek cache, and peeks which had to wait for a readback.
+    int num_efb_peek_cache_hits;
+    int num_efb_peek_cache_misses;
+
+    // EFB copies to RAM which were written in a batch at a GPU sync point, written immediately
+    // or early because the texture cache read their memory, and overwritten before being written.
+    int num_efb_copies_to_ram_deferred;
+    int num_efb_copies_to_ram_forced;
+    int num_efb_copies_to_ram_discarded;
+
+    // Indexed by FlushReason.
+    std::array<int, static_cast<size_t>(FlushReason::Count)> num_flushes;
+    // Register and XF memory writes which didn't flush because nothing changed.
+    int num_redundant_state_writes;
   };
   ThisFrame this_frame;
+
+  // Wall time of the last frame, and the part of it spent in each stage. In dual core, the stages
+  // run on two threads, so only the stages of one thread add up to at most the frame time.
+  // Only updated while the stage timing overlay or log is enabled.
+  std::chrono::nanoseconds frame_time{};
+  StageTimers::Durations frame_stage_times{};
+
   void ResetFrame();
   void SwapDL();
   void Display() const;
   void DisplayProj() const;
+  void DisplayStageTimes() const;
 };
 
 extern Statistics g_stats;
@@ -47,6 +47,7 @@
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/TextureConverterShaderGen.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderWorkers.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -96,6 +97,9 @@ TextureCacheBase::TextureCacheBase()
 
   Common::SetHash64Function();
 
+  m_decoder_workers = std::make_unique<VideoCommon::TextureDecoderWorkers>();
+  m_decoder_workers->ResizeWorkerThreads(g_ActiveConfig.GetTextureDecoderThreads());
+
   InvalidateAllBindPoints();
 }
 
@@ -133,6 +137,7 @@ void TextureCacheBase::Invalidate()
   }
   textures_by_address.clear();
   textures_by_hash.clear();
+  max_texture_size_in_cache = 0;
 
   texture_pool.clear();
 }
@@ -169,6 +174,8 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  m_decoder_workers->ResizeWorkerThreads(config.GetTextureDecoderThreads());
+
   SetBackupConfig(config);
 }
 
@@ -216,6 +223,11 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
+  // Shrink the overlap search window back down to the largest texture which is still alive.
+  max_texture_size_in_cache = 0;
+  for (const auto& it : textures_by_address)
+    max_texture_size_in_cache = std::max(max_texture_size_in_cache, it.second->size_in_bytes);
+
   TexPool::iterator iter2 = texture_pool.begin();
   TexPool::iterator tcend2 = texture_pool.end();
   while (iter2 != tcend2)
@@ -325,7 +337,7 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, u8* palette, TLUTForma
     g_renderer->EndUtilityDrawing();
   }
 
-  textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -372,7 +384,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::ReinterpretEntry(const TCacheEn
   g_renderer->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -696,7 +708,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     TCacheEntry* entry = GetEntry(id);
     if (entry)
-      textures_by_address.emplace(addr, entry);
+      AddToAddressCache(addr, entry);
   }
 
   // Fill in hash map.
@@ -1502,6 +1514,16 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
     }
   }
 
+  // The texture is decoded from RAM, so any pending EFB copies to it have to be written first.
+  // That changes the hashes, so look it up again. Copies which are used from VRAM, like render
+  // targets, still match the hash of the stale RAM, and stay deferred.
+  if (!from_tmem && FlushEFBCopiesInRange(address, texture_size + additional_mips_size))
+  {
+    return GetTexture(address, width, height, texformat, textureCacheSafetyColorSampleSize,
+                      tlutaddr, tlutfmt, use_mipmaps, tex_levels, from_tmem, tmem_address_even,
+                      tmem_address_odd);
+  }
+
   // If at least one entry was not used for the same frame, overwrite the oldest one
   if (temp_frameCount != 0x7fffffff)
   {
@@ -1587,8 +1609,8 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
       dst_buffer = temp;
       if (!(texformat == TextureFormat::RGBA8 && from_tmem))
       {
-        TexDecoder_Decode(dst_buffer, src_data, expandedWidth, expandedHeight, texformat, tlut,
-                          tlutfmt);
+        DecodeTexture(dst_buffer, src_data, expandedWidth, expandedHeight, texformat, tlut,
+                      tlutfmt);
       }
       else
       {
@@ -1605,13 +1627,6 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
     }
   }
 
-  iter = textures_by_address.emplace(address, entry);
-  if (textureCacheSafetyColorSampleSize == 0 ||
-      std::max(texture_size, palette_size) <= (u32)textureCacheSafetyColorSampleSize * 8)
-  {
-    entry->textures_by_hash_iter = textures_by_hash.emplace(full_hash, entry);
-  }
-
   entry->SetGeneralParameters(address, texture_size, full_format, false);
   entry->SetDimensions(nativeW, nativeH, tex_levels);
   entry->SetHashes(base_hash, full_hash);
@@ -1619,6 +1634,13 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  iter = AddToAddressCache(address, entry);
+  if (textureCacheSafetyColorSampleSize == 0 ||
+      std::max(texture_size, palette_size) <= (u32)textureCacheSafetyColorSampleSize * 8)
+  {
+    entry->textures_by_hash_iter = textures_by_hash.emplace(full_hash, entry);
+  }
+
   std::string basename;
   if (g_ActiveConfig.bDumpTextures && !hires_tex)
   {
@@ -1666,8 +1688,8 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
       {
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size = expanded_mip_width * sizeof(u32) * expanded_mip_height;
-        TexDecoder_Decode(dst_buffer, mip_src_data, expanded_mip_width, expanded_mip_height,
-                          texformat, tlut, tlutfmt);
+        DecodeTexture(dst_buffer, mip_src_data, expanded_mip_width, expanded_mip_height,
+                      texformat, tlut, tlutfmt);
         entry->texture->Load(level, mip_width, mip_height, expanded_mip_width, dst_buffer,
                              decoded_mip_size);
 
@@ -1767,7 +1789,7 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1978,7 +2000,7 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
     {
       const u64 entry_hash = entry->CalculateHash();
       entry->SetHashes(entry_hash, entry_hash);
-      textures_by_address.emplace(address, entry);
+      AddToAddressCache(address, entry);
     }
   }
 
@@ -2423,12 +2445,15 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
               scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
 
+      DiscardOverwrittenEFBCopies(dstAddr, bytes_per_row, num_blocks_y, dstStride);
+
       // We can't defer if there is no VRAM copy (since we need to update the hash).
       if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
       {
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
                           std::move(staging_texture));
+        INCSTAT(g_stats.this_frame.num_efb_copies_to_ram_forced);
       }
       else
       {
@@ -2542,7 +2567,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    textures_by_address.emplace(dstAddr, entry);
+    AddToAddressCache(dstAddr, entry);
   }
 }
 
@@ -2553,9 +2578,63 @@ void TextureCacheBase::FlushEFBCopies()
 
   for (TCacheEntry* entry : m_pending_efb_copies)
     FlushEFBCopy(entry);
+  ADDSTAT(g_stats.this_frame.num_efb_copies_to_ram_deferred, m_pending_efb_copies.size());
   m_pending_efb_copies.clear();
 }
 
+bool TextureCacheBase::FlushEFBCopiesInRange(u32 address, u32 size)
+{
+  // A later copy may overwrite part of an earlier one, so flush every copy up to the last one
+  // which overlaps the range, not just the overlapping ones.
+  const auto last_overlapping = std::find_if(
+      m_pending_efb_copies.rbegin(), m_pending_efb_copies.rend(),
+      [&](const TCacheEntry* entry) { return entry->OverlapsMemoryRange(address, size); });
+  if (last_overlapping == m_pending_efb_copies.rend())
+    return false;
+
+  const auto end = last_overlapping.base();
+  for (auto iter = m_pending_efb_copies.begin(); iter != end; ++iter)
+    FlushEFBCopy(*iter);
+  ADDSTAT(g_stats.this_frame.num_efb_copies_to_ram_forced, end - m_pending_efb_copies.begin());
+  m_pending_efb_copies.erase(m_pending_efb_copies.begin(), end);
+  return true;
+}
+
+void TextureCacheBase::DiscardOverwrittenEFBCopies(u32 dst_addr, u32 bytes_per_row,
+                                                   u32 num_blocks_y, u32 dst_stride)
+{
+  // Copies which are still in the cache were already handled when invalidating overlapping
+  // textures. The others are only kept around until they are flushed.
+  const auto is_overwritten = [&](const TCacheEntry* entry) {
+    if (!entry->pending_efb_copy_invalidated || entry->memory_stride != dst_stride ||
+        entry->addr < dst_addr)
+    {
+      return false;
+    }
+
+    const u32 offset = entry->addr - dst_addr;
+    const u32 entry_bytes_per_row = entry->pending_efb_copy_width * sizeof(u32);
+    return offset % dst_stride + entry_bytes_per_row <= bytes_per_row &&
+           offset / dst_stride + entry->pending_efb_copy_height <= num_blocks_y;
+  };
+
+  auto iter = m_pending_efb_copies.begin();
+  while (iter != m_pending_efb_copies.end())
+  {
+    TCacheEntry* entry = *iter;
+    if (!is_overwritten(entry))
+    {
+      ++iter;
+      continue;
+    }
+
+    ReleaseEFBCopyStagingTexture(std::move(entry->pending_efb_copy));
+    delete entry;
+    iter = m_pending_efb_copies.erase(iter);
+    INCSTAT(g_stats.this_frame.num_efb_copies_to_ram_discarded);
+  }
+}
+
 void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                                          std::unique_ptr<AbstractStagingTexture> staging_texture)
 {
@@ -2742,20 +2821,45 @@ TextureCacheBase::GetTexCacheIter(TextureCacheBase::TCacheEntry* entry)
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
-  // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
+  return FindOverlappingTextures(textures_by_address, max_texture_size_in_cache, addr,
+                                 size_in_bytes);
+}
 
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
-  auto begin = textures_by_address.lower_bound(lower_addr);
-  auto end = textures_by_address.upper_bound(addr + size_in_bytes);
+std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
+TextureCacheBase::FindOverlappingTextures(TexAddrCache& textures, u32 max_texture_size, u32 addr,
+                                          u32 size_in_bytes)
+{
+  // We index by the starting address only, so there is no way to query all textures
+  // which end after the given addr. But no texture in the cache is larger than
+  // max_texture_size, so we look for all textures which have a start address bigger
+  // than addr minus that size. This yields false-positives which must be checked later on.
+  // Tracking the actual maximum instead of the largest possible GC texture (1024 x 1024 texels
+  // times 8 nibbles per texel) keeps the scanned range small for the common case of many small
+  // textures.
+  const u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
+  auto begin = textures.lower_bound(lower_addr);
+  auto end = textures.upper_bound(addr + size_in_bytes);
 
   return std::make_pair(begin, end);
 }
 
+void TextureCacheBase::DecodeTexture(u8* dst, const u8* src, u32 width, u32 height,
+                                     TextureFormat format, const u8* tlut, TLUTFormat tlut_format)
+{
+  // The format overlay is drawn over the whole texture, so it can't be split into bands.
+  if (m_decoder_workers->HasWorkerThreads() && !backup_config.texfmt_overlay)
+    m_decoder_workers->Decode(dst, src, width, height, format, tlut, tlut_format);
+  else
+    TexDecoder_Decode(dst, src, width, height, format, tlut, tlut_format);
+}
+
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToAddressCache(u32 address,
+                                                                           TCacheEntry* entry)
+{
+  max_texture_size_in_cache = std::max(max_texture_size_in_cache, entry->size_in_bytes);
+  return textures_by_address.emplace(address, entry);
+}
+
 TextureCacheBase::TexAddrCache::iterator
 TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pending_efb_copy)
 {
@@ -2801,6 +2905,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
       auto pending_it = std::find(m_pending_efb_copies.begin(), m_pending_efb_copies.end(), entry);
       if (pending_it != m_pending_efb_copies.end())
         m_pending_efb_copies.erase(pending_it);
+      INCSTAT(g_stats.this_frame.num_efb_copies_to_ram_discarded);
     }
     else
     {
@@ -27,6 +27,11 @@ class AbstractStagingTexture;
 class PointerWrap;
 struct VideoConfig;
 
+namespace VideoCommon
+{
+class TextureDecoderWorkers;
+}
+
 struct TextureAndTLUTFormat
 {
   TextureAndTLUTFormat(TextureFormat texfmt_ = TextureFormat::I4,
@@ -239,6 +244,10 @@ public:
   // Flushes all pending EFB copies to emulated RAM.
   void FlushEFBCopies();
 
+  // Flushes the pending EFB copies which overlap the given range of emulated RAM, along with any
+  // older copies, so that they still reach RAM in order. Returns true if anything was flushed.
+  bool FlushEFBCopiesInRange(u32 address, u32 size);
+
   // Texture Serialization
   void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p);
   std::optional<TexPoolEntry> DeserializeTexture(PointerWrap& p);
@@ -249,6 +258,15 @@ public:
   // Returns false if the top/bottom row coefficients are zero.
   static bool NeedsCopyFilterInShader(const EFBCopyFilterCoefficients& coefficients);
 
+  using TexAddrCache = std::multimap<u32, TCacheEntry*>;
+
+  // Return all entries of textures that possibly overlap the given range, given that none of them
+  // is larger than max_texture_size. As addr+size of the textures is not indexed, this may return
+  // false positives.
+  static std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
+  FindOverlappingTextures(TexAddrCache& textures, u32 max_texture_size, u32 addr,
+                          u32 size_in_bytes);
+
 protected:
   // Decodes the specified data to the GPU texture specified by entry.
   // Returns false if the configuration is not supported.
@@ -278,7 +296,6 @@ protected:
   static std::bitset<8> valid_bind_points;
 
 private:
-  using TexAddrCache = std::multimap<u32, TCacheEntry*>;
   using TexHashCache = std::multimap<u64, TCacheEntry*>;
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
@@ -296,6 +313,10 @@ private:
                                        TLUTFormat tlutfmt);
   void StitchXFBCopy(TCacheEntry* entry_to_update);
 
+  // Decodes a texture on the CPU, splitting large textures across the decoder worker threads.
+  void DecodeTexture(u8* dst, const u8* src, u32 width, u32 height, TextureFormat format,
+                     const u8* tlut, TLUTFormat tlut_format);
+
   void DumpTexture(TCacheEntry* entry, std::string basename, unsigned int level, bool is_arbitrary);
   void CheckTempSize(size_t required_size);
 
@@ -304,6 +325,10 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Inserts the entry into textures_by_address. The entry's size must already be set, as it is
+  // used to bound the search range of FindOverlappingTextures.
+  TexAddrCache::iterator AddToAddressCache(u32 address, TCacheEntry* entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -326,6 +351,11 @@ private:
                          std::unique_ptr<AbstractStagingTexture> staging_texture);
   void FlushEFBCopy(TCacheEntry* entry);
 
+  // Drops pending copies that are no longer in the cache and which the new copy overwrites
+  // entirely, as writing them to RAM later would be wasted work.
+  void DiscardOverwrittenEFBCopies(u32 dst_addr, u32 bytes_per_row, u32 num_blocks_y,
+                                   u32 dst_stride);
+
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
 
@@ -339,6 +369,9 @@ private:
   TexAddrCache textures_by_address;
   TexHashCache textures_by_hash;
   TexPool texture_pool;
+  // Largest size_in_bytes of any entry in textures_by_address. Only grows between calls to
+  // Cleanup, which recomputes it from the remaining entries.
+  u32 max_texture_size_in_cache = 0;
   u64 last_entry_id = 0;
 
   // Backup configuration values
@@ -365,6 +398,9 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Worker threads used to split CPU decoding of large textures.
+  std::unique_ptr<VideoCommon::TextureDecoderWorkers> m_decoder_workers;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
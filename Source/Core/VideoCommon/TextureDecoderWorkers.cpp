@@ -0,0 +1,132 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/TextureDecoderWorkers.h"
+
+#include <algorithm>
+
+#include "Common/Thread.h"
+
+namespace VideoCommon
+{
+// Below this many texels per band, waking a worker costs more than it saves.
+constexpr u32 MIN_TEXELS_PER_BAND = 128 * 128;
+
+TextureDecoderWorkers::TextureDecoderWorkers() = default;
+
+TextureDecoderWorkers::~TextureDecoderWorkers()
+{
+  StopWorkerThreads();
+}
+
+void TextureDecoderWorkers::ResizeWorkerThreads(u32 num_worker_threads)
+{
+  if (m_worker_threads.size() == num_worker_threads)
+    return;
+
+  StopWorkerThreads();
+  for (u32 i = 0; i < num_worker_threads; i++)
+    m_worker_threads.emplace_back(&TextureDecoderWorkers::WorkerThreadRun, this);
+}
+
+bool TextureDecoderWorkers::HasWorkerThreads() const
+{
+  return !m_worker_threads.empty();
+}
+
+void TextureDecoderWorkers::StopWorkerThreads()
+{
+  if (!HasWorkerThreads())
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_exit = true;
+  }
+  m_worker_thread_wake.notify_all();
+
+  for (std::thread& thr : m_worker_threads)
+    thr.join();
+  m_worker_threads.clear();
+  m_exit = false;
+}
+
+void TextureDecoderWorkers::DecodeBand(const Band& band)
+{
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(band.dst), band.src, band.width, band.height,
+                         band.format, band.tlut, band.tlut_format);
+}
+
+void TextureDecoderWorkers::Decode(u8* dst, const u8* src, u32 width, u32 height,
+                                   TextureFormat format, const u8* tlut, TLUTFormat tlut_format)
+{
+  const u32 block_width = TexDecoder_GetBlockWidthInTexels(format);
+  const u32 block_height = TexDecoder_GetBlockHeightInTexels(format);
+  const u32 block_rows = height / block_height;
+  const u32 texels_per_block_row = width * block_height;
+  const u32 max_bands =
+      std::max(block_rows * texels_per_block_row / MIN_TEXELS_PER_BAND, static_cast<u32>(1));
+  const u32 num_bands = std::min({static_cast<u32>(m_worker_threads.size()) + 1, max_bands,
+                                  std::max(block_rows, static_cast<u32>(1))});
+
+  if (num_bands <= 1)
+  {
+    DecodeBand({dst, src, width, height, format, tlut, tlut_format});
+    return;
+  }
+
+  const u32 src_bytes_per_block_row =
+      (width / block_width) * block_width * block_height *
+      TexDecoder_GetTexelSizeInNibbles(format) / 2;
+  const u32 dst_bytes_per_block_row = texels_per_block_row * sizeof(u32);
+
+  // Spread the block rows as evenly as possible; the first bands get one extra row if needed.
+  std::vector<Band> bands;
+  bands.reserve(num_bands);
+  u32 block_row = 0;
+  for (u32 i = 0; i < num_bands; i++)
+  {
+    const u32 band_rows = block_rows / num_bands + (i < block_rows % num_bands ? 1 : 0);
+    bands.push_back({dst + block_row * dst_bytes_per_block_row,
+                     src + block_row * src_bytes_per_block_row, width, band_rows * block_height,
+                     format, tlut, tlut_format});
+    block_row += band_rows;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_pending_bands.insert(m_pending_bands.end(), bands.begin() + 1, bands.end());
+    m_busy_bands += num_bands - 1;
+  }
+  m_worker_thread_wake.notify_all();
+
+  DecodeBand(bands[0]);
+
+  std::unique_lock<std::mutex> lock(m_lock);
+  m_bands_done.wait(lock, [this] { return m_busy_bands == 0; });
+}
+
+void TextureDecoderWorkers::WorkerThreadRun()
+{
+  Common::SetCurrentThreadName("Texture decoder worker");
+
+  std::unique_lock<std::mutex> lock(m_lock);
+  while (true)
+  {
+    m_worker_thread_wake.wait(lock, [this] { return m_exit || !m_pending_bands.empty(); });
+    if (m_exit)
+      return;
+
+    const Band band = m_pending_bands.back();
+    m_pending_bands.pop_back();
+    lock.unlock();
+
+    DecodeBand(band);
+
+    lock.lock();
+    if (--m_busy_bands == 0)
+      m_bands_done.notify_one();
+  }
+}
+}  // namespace VideoCommon
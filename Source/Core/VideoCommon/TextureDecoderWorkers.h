@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Splits CPU texture decoding of large textures across a set of worker threads.
+// Textures are stored as rows of blocks, so each band of whole block rows can be decoded as
+// an independent texture. The calling thread decodes the first band itself, and then waits for
+// the workers to finish the remaining bands, so callers still see a synchronous decode.
+class TextureDecoderWorkers
+{
+public:
+  TextureDecoderWorkers();
+  ~TextureDecoderWorkers();
+
+  void ResizeWorkerThreads(u32 num_worker_threads);
+  bool HasWorkerThreads() const;
+
+  // Equivalent to TexDecoder_Decode, except that the format overlay is never drawn.
+  // width and height must be aligned to the block size of the format.
+  void Decode(u8* dst, const u8* src, u32 width, u32 height, TextureFormat format,
+              const u8* tlut, TLUTFormat tlut_format);
+
+private:
+  struct Band
+  {
+    u8* dst;
+    const u8* src;
+    u32 width;
+    u32 height;
+    TextureFormat format;
+    const u8* tlut;
+    TLUTFormat tlut_format;
+  };
+
+  static void DecodeBand(const Band& band);
+
+  void StopWorkerThreads();
+  void WorkerThreadRun();
+
+  std::vector<std::thread> m_worker_threads;
+
+  std::mutex m_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::condition_variable m_bands_done;
+  std::vector<Band> m_pending_bands;
+  u32 m_busy_bands = 0;
+  bool m_exit = false;
+};
+}  // namespace VideoCommon
@@ -1409,6 +1409,212 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// AVX2 decoders for the formats that have no SSE path above. Palette lookups use 32-bit gathers
+// at 2-byte granularity, so they may read up to 2 bytes past the last TLUT entry that is used.
+// This is always inside texMem for the TLUTs passed in by the texture cache.
+
+// Expands 8 16-bit colors, zero-extended in the 32-bit lanes of a register, to RGBA8.
+// The colors are in host byte order, i.e. already byte swapped from guest memory.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB565_AVX2(__m256i val)
+{
+  const __m256i mask_x1f = _mm256_set1_epi32(0x1f);
+  const __m256i mask_x3f = _mm256_set1_epi32(0x3f);
+
+  const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(val, 11), mask_x1f);
+  const __m256i g6 = _mm256_and_si256(_mm256_srli_epi32(val, 5), mask_x3f);
+  const __m256i b5 = _mm256_and_si256(val, mask_x1f);
+
+  const __m256i r8 = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+  const __m256i g8 = _mm256_or_si256(_mm256_slli_epi32(g6, 2), _mm256_srli_epi32(g6, 4));
+  const __m256i b8 = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+
+  return _mm256_or_si256(
+      _mm256_or_si256(r8, _mm256_slli_epi32(g8, 8)),
+      _mm256_or_si256(_mm256_slli_epi32(b8, 16), _mm256_set1_epi32(0xFF000000)));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePixels_RGB5A3_AVX2(__m256i val)
+{
+  const __m256i mask_x1f = _mm256_set1_epi32(0x1f);
+  const __m256i mask_x0f = _mm256_set1_epi32(0x0f);
+  const __m256i mask_x07 = _mm256_set1_epi32(0x07);
+  const __m256i mul_x11 = _mm256_set1_epi32(0x11);
+
+  // Opaque: 1RRRRRGG GGGBBBBB
+  const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(val, 10), mask_x1f);
+  const __m256i g5 = _mm256_and_si256(_mm256_srli_epi32(val, 5), mask_x1f);
+  const __m256i b5 = _mm256_and_si256(val, mask_x1f);
+  const __m256i r5_8 = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+  const __m256i g5_8 = _mm256_or_si256(_mm256_slli_epi32(g5, 3), _mm256_srli_epi32(g5, 2));
+  const __m256i b5_8 = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+  const __m256i opaque = _mm256_or_si256(
+      _mm256_or_si256(r5_8, _mm256_slli_epi32(g5_8, 8)),
+      _mm256_or_si256(_mm256_slli_epi32(b5_8, 16), _mm256_set1_epi32(0xFF000000)));
+
+  // Translucent: 0AAARRRR GGGGBBBB
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), mask_x07);
+  const __m256i r4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), mask_x0f);
+  const __m256i g4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), mask_x0f);
+  const __m256i b4 = _mm256_and_si256(val, mask_x0f);
+  const __m256i a3_8 = _mm256_or_si256(
+      _mm256_or_si256(_mm256_slli_epi32(a3, 5), _mm256_slli_epi32(a3, 2)),
+      _mm256_srli_epi32(a3, 1));
+  const __m256i translucent = _mm256_or_si256(
+      _mm256_or_si256(_mm256_mullo_epi16(r4, mul_x11),
+                      _mm256_slli_epi32(_mm256_mullo_epi16(g4, mul_x11), 8)),
+      _mm256_or_si256(_mm256_slli_epi32(_mm256_mullo_epi16(b4, mul_x11), 16),
+                      _mm256_slli_epi32(a3_8, 24)));
+
+  // Select on the top bit of the 16-bit color.
+  const __m256i is_opaque = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(translucent, opaque, is_opaque);
+}
+
+// Looks up 8 palette indices, given as 32-bit lanes, and decodes the entries to RGBA8.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodePaletteEntries_AVX2(__m256i indices, const u8* tlut,
+                                                TLUTFormat tlutfmt)
+{
+  // Each lane now holds the two big-endian bytes of an entry in its low half, plus two bytes of
+  // the following entry which are shuffled away below.
+  const __m256i entries =
+      _mm256_i32gather_epi32(reinterpret_cast<const int*>(tlut), indices, 2);
+
+  if (tlutfmt == TLUTFormat::IA8)
+  {
+    // IA8 entries are stored as AI. Broadcast I to RGB.
+    const __m256i ia8_to_rgba = _mm256_setr_epi8(
+        1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12, 1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8,
+        13, 13, 13, 12);
+    return _mm256_shuffle_epi8(entries, ia8_to_rgba);
+  }
+
+  // Byte swap the entry and clear the upper half of the lane.
+  const __m256i swap16 =
+      _mm256_setr_epi8(1, 0, -1, -1, 5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1, 1, 0, -1, -1,
+                       5, 4, -1, -1, 9, 8, -1, -1, 13, 12, -1, -1);
+  const __m256i val = _mm256_shuffle_epi8(entries, swap16);
+
+  if (tlutfmt == TLUTFormat::RGB565)
+    return DecodePixels_RGB565_AVX2(val);
+  return DecodePixels_RGB5A3_AVX2(val);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  if (!IsValidTLUTFormat(tlutfmt))
+    return;
+
+  const __m128i mask_x0f = _mm_set1_epi8(0x0f);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        // 4 bytes hold 8 texels, high nibble first.
+        u32 packed;
+        std::memcpy(&packed, src + 4 * xStep, sizeof(packed));
+        const __m128i bytes = _mm_cvtsi32_si128(packed);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask_x0f);
+        const __m128i lo = _mm_and_si128(bytes, mask_x0f);
+        const __m256i indices = _mm256_cvtepu8_epi32(_mm_unpacklo_epi8(hi, lo));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (y + iy) * width + x),
+                            DecodePaletteEntries_AVX2(indices, tlut, tlutfmt));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  if (!IsValidTLUTFormat(tlutfmt))
+    return;
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i indices = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 8 * xStep)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (y + iy) * width + x),
+                            DecodePaletteEntries_AVX2(indices, tlut, tlutfmt));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  if (!IsValidTLUTFormat(tlutfmt))
+    return;
+
+  const __m128i swap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m256i mask_x3fff = _mm256_set1_epi32(0x3fff);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      // Rows of a block are contiguous, so decode two rows of 4 texels at a time.
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m128i rows = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8 * xStep)), swap16);
+        const __m256i indices = _mm256_and_si256(_mm256_cvtepu16_epi32(rows), mask_x3fff);
+        const __m256i texels = DecodePaletteEntries_AVX2(indices, tlut, tlutfmt);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (y + iy) * width + x),
+                         _mm256_castsi256_si128(texels));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (y + iy + 1) * width + x),
+                         _mm256_extracti128_si256(texels, 1));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i mask_x0f = _mm256_set1_epi32(0x0f);
+  const __m256i mul_x11 = _mm256_set1_epi32(0x11);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        // AAAAIIII, one byte per texel.
+        const __m256i val = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 8 * xStep)));
+        const __m256i i8 = _mm256_mullo_epi16(_mm256_and_si256(val, mask_x0f), mul_x11);
+        const __m256i a8 = _mm256_mullo_epi16(_mm256_srli_epi32(val, 4), mul_x11);
+        const __m256i texels = _mm256_or_si256(
+            _mm256_or_si256(i8, _mm256_slli_epi32(i8, 8)),
+            _mm256_or_si256(_mm256_slli_epi32(i8, 16), _mm256_slli_epi32(a8, 24)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + (y + iy) * width + x), texels);
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1418,7 +1624,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
@@ -1438,11 +1648,20 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
@@ -1455,8 +1674,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
@@ -172,8 +172,11 @@ int VertexLoaderARM64::ReadVertex(u64 attribute, int format, int count_in, int c
     m_float_emit.REV32(8, coords, coords);
   }
 
-  const u32 write_size = count_out == 3 ? 128 : count_out * 32;
-  const u32 mask = count_out == 3 ? 0xF : count_out == 2 ? 0x7 : 0x3;
+  // Three components are stored as two and one. A 16-byte store would overwrite the first
+  // component of the next vertex, which may already have been written by another thread, see
+  // VertexLoaderWorkers.
+  const u32 write_size = count_out == 3 ? 64 : count_out * 32;
+  const u32 mask = count_out == 1 ? 0x3 : 0x7;
   if (m_dst_ofs < 256)
   {
     m_float_emit.STUR(write_size, coords, dst_reg, m_dst_ofs);
@@ -185,7 +188,12 @@ int VertexLoaderARM64::ReadVertex(u64 attribute, int format, int count_in, int c
   else
   {
     ADD(EncodeRegTo64(scratch2_reg), dst_reg, m_dst_ofs);
-    m_float_emit.ST1(32, 1, coords, EncodeRegTo64(scratch2_reg));
+    m_float_emit.ST1(32, 1, EncodeRegToDouble(coords), EncodeRegTo64(scratch2_reg));
+  }
+  if (count_out == 3)
+  {
+    ADD(EncodeRegTo64(scratch2_reg), dst_reg, m_dst_ofs + 8);
+    m_float_emit.ST1(32, coords, 2, EncodeRegTo64(scratch2_reg));
   }
 
   // Z-Freeze
@@ -196,7 +204,8 @@ int VertexLoaderARM64::ReadVertex(u64 attribute, int format, int count_in, int c
     MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_cache);
     ADD(EncodeRegTo64(scratch1_reg), EncodeRegTo64(scratch2_reg), EncodeRegTo64(count_reg),
         ArithOption(EncodeRegTo64(count_reg), ST_LSL, 4));
-    m_float_emit.STUR(write_size, coords, EncodeRegTo64(scratch1_reg), -16);
+    m_float_emit.STUR(count_out == 3 ? 128 : write_size, coords, EncodeRegTo64(scratch1_reg),
+                      -16);
     SetJumpTarget(dont_store);
   }
 
@@ -140,7 +140,8 @@ std::string VertexLoaderBase::ToString() const
     dest += fmt::format("T{}: {} {}-{} ", i, tex_coord.Elements, pos_mode[tex_mode[i]],
                         pos_formats[tex_coord.Format]);
   }
-  dest += fmt::format(" - {} v", m_numLoadedVertices);
+  dest += fmt::format(" - {} v{}", m_numLoadedVertices.load(),
+                      m_precompiled ? " (precompiled)" : "");
   return dest;
 }
 
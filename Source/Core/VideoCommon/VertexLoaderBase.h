@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -20,6 +21,8 @@ class VertexLoaderUID
   size_t hash;
 
 public:
+  using Data = std::array<u32, 5>;
+
   VertexLoaderUID() {}
   VertexLoaderUID(const TVtxDesc& vtx_desc, const VAT& vat)
   {
@@ -30,10 +33,28 @@ public:
     vid[4] = vat.g2.Hex;
     hash = CalculateHash();
   }
+  explicit VertexLoaderUID(const Data& data) : vid(data) { hash = CalculateHash(); }
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  // The raw register values, e.g. for storing the UID in a disk cache.
+  const Data& GetData() const { return vid; }
+  TVtxDesc GetVtxDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.Hex = vid[0] | (static_cast<u64>(vid[1]) << 32);
+    return vtx_desc;
+  }
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
+
 private:
   size_t CalculateHash() const
   {
@@ -66,6 +87,8 @@ public:
   virtual int RunVertices(DataReader src, DataReader dst, int count) = 0;
 
   virtual bool IsInitialized() = 0;
+  // Whether RunVertices may be called from several threads at once. See VertexLoaderWorkers.
+  virtual bool IsReentrant() const { return false; }
 
   // For debugging / profiling
   std::string ToString() const;
@@ -79,7 +102,9 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
-  int m_numLoadedVertices = 0;
+  std::atomic<int> m_numLoadedVertices{0};
+  // Compiled ahead of use from the vertex loader disk cache.
+  bool m_precompiled = false;
 
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
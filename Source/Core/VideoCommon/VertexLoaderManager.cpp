@@ -5,16 +5,21 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 #include "Core/HW/Memmap.h"
 
 #include "VideoCommon/BPMemory.h"
@@ -23,10 +28,14 @@
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderWorkers.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace VertexLoaderManager
 {
@@ -45,6 +54,15 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Every vertex format the game has used, so that the next session can compile the loaders
+// before the game first draws with them. Only the UID is stored; the loaders are rebuilt.
+// Appended to with s_vertex_loader_map_lock held.
+static LinearDiskCache<VertexLoaderUID::Data, u8> s_disk_cache;
+static std::thread s_precompile_thread;
+static std::atomic_bool s_precompile_cancelled;
+
+static std::unique_ptr<VideoCommon::VertexLoaderWorkers> s_workers;
+
 u8* cached_arraybases[12];
 
 void Init()
@@ -57,9 +75,84 @@ void Init()
   SETSTAT(g_stats.num_vertex_loaders, 0);
 }
 
+static void PrecompileVertexLoaders(std::vector<VertexLoaderUID> uids)
+{
+  Common::SetCurrentThreadName("Vertex loader precompiler");
+
+  for (const VertexLoaderUID& uid : uids)
+  {
+    if (s_precompile_cancelled.load(std::memory_order_relaxed))
+      return;
+
+    {
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+      if (s_vertex_loader_map.count(uid))
+        continue;
+    }
+
+    // Compile without the lock held, so the GPU thread is never blocked behind us. If it created
+    // the same loader in the meantime, ours is simply dropped.
+    std::unique_ptr<VertexLoaderBase> loader =
+        VertexLoaderBase::CreateVertexLoader(uid.GetVtxDesc(), uid.GetVAT());
+    loader->m_precompiled = true;
+
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    s_vertex_loader_map.emplace(uid, std::move(loader));
+  }
+}
+
+void LoadDiskCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  class CacheReader : public LinearDiskCacheReader<VertexLoaderUID::Data, u8>
+  {
+  public:
+    void Read(const VertexLoaderUID::Data& key, const u8* value, u32 value_size) override
+    {
+      uids.emplace_back(key);
+    }
+
+    std::vector<VertexLoaderUID> uids;
+  };
+
+  // Vertex loaders don't depend on the backend, so all of them share the cache.
+  const std::string filename =
+      GetDiskShaderCacheFileName(g_ActiveConfig.backend_info.api_type, "VertexLoader", true, false,
+                                 false);
+  CacheReader reader;
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(VIDEO, "Loaded {} cached vertex formats from {}", reader.uids.size(), filename);
+
+  if (reader.uids.empty())
+    return;
+
+  s_precompile_cancelled.store(false);
+  s_precompile_thread = std::thread(PrecompileVertexLoaders, std::move(reader.uids));
+}
+
+void UpdateWorkerThreads()
+{
+  if (!s_workers)
+    s_workers = std::make_unique<VideoCommon::VertexLoaderWorkers>();
+  s_workers->ResizeWorkerThreads(g_ActiveConfig.GetVertexLoaderThreads());
+}
+
 void Clear()
 {
+  if (s_precompile_thread.joinable())
+  {
+    s_precompile_cancelled.store(true);
+    s_precompile_thread.join();
+  }
+
+  s_workers.reset();
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_disk_cache.Sync();
+  s_disk_cache.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
@@ -223,8 +316,14 @@ static VertexLoaderBase* RefreshLoader(int vtx_attr_group, bool preprocess = fal
       s_vertex_loader_map[uid] =
           VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
       loader = s_vertex_loader_map[uid].get();
-      INCSTAT(g_stats.num_vertex_loaders);
+      if (s_disk_cache.IsOpen())
+      {
+        // Only the UID is stored, but the empty value still goes through fwrite.
+        static constexpr u8 no_value = 0;
+        s_disk_cache.Append(uid.GetData(), &no_value, 0);
+      }
     }
+    SETSTAT(g_stats.num_vertex_loaders, s_vertex_loader_map.size());
     if (check_for_native_format)
     {
       // search for a cached native vertex format
@@ -267,7 +366,7 @@ int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bo
   if (loader->m_native_vertex_format != s_current_vtx_fmt ||
       loader->m_native_components != g_current_components)
   {
-    g_vertex_manager->Flush();
+    g_vertex_manager->Flush(FlushReason::VertexFormat);
   }
   s_current_vtx_fmt = loader->m_native_vertex_format;
   g_current_components = loader->m_native_components;
@@ -281,7 +380,13 @@ int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bo
   DataReader dst = g_vertex_manager->PrepareForAdditionalData(
       primitive, count, loader->m_native_vtx_decl.stride, cullall);
 
-  count = loader->RunVertices(src, dst, count);
+  {
+    StageTimers::ScopedTimer stage_timer(StageTimers::Stage::VertexLoad);
+    if (s_workers && s_workers->HasWorkerThreads())
+      count = s_workers->RunVertices(loader, src, dst, count);
+    else
+      count = loader->RunVertices(src, dst, count);
+  }
 
   g_vertex_manager->AddIndices(primitive, count);
   g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
@@ -22,6 +22,13 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Reads the vertex formats used by previous sessions of the current game, and compiles their
+// loaders on a background thread. Requires the active config to be set up.
+void LoadDiskCache();
+
+// Starts or stops the threads which convert large primitive batches, to match the active config.
+void UpdateWorkerThreads();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/VertexLoaderWorkers.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Thread.h"
+#include "VideoCommon/DataReader.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+namespace VideoCommon
+{
+// Below this many vertices per band, waking a worker costs more than it saves.
+constexpr int MIN_VERTICES_PER_BAND = 2048;
+
+// The loaders write the position and position matrix of the last three vertices of each call to
+// VertexLoaderManager::position_cache, for zfreeze.
+constexpr int NUM_CACHED_POSITIONS = 3;
+
+VertexLoaderWorkers::VertexLoaderWorkers() = default;
+
+VertexLoaderWorkers::~VertexLoaderWorkers()
+{
+  StopWorkerThreads();
+}
+
+void VertexLoaderWorkers::ResizeWorkerThreads(u32 num_worker_threads)
+{
+  if (m_worker_threads.size() == num_worker_threads)
+    return;
+
+  StopWorkerThreads();
+  for (u32 i = 0; i < num_worker_threads; i++)
+    m_worker_threads.emplace_back(&VertexLoaderWorkers::WorkerThreadRun, this);
+}
+
+bool VertexLoaderWorkers::HasWorkerThreads() const
+{
+  return !m_worker_threads.empty();
+}
+
+void VertexLoaderWorkers::StopWorkerThreads()
+{
+  if (!HasWorkerThreads())
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_exit = true;
+  }
+  m_worker_thread_wake.notify_all();
+
+  for (std::thread& thr : m_worker_threads)
+    thr.join();
+  m_worker_threads.clear();
+  m_exit = false;
+}
+
+void VertexLoaderWorkers::RunBand(Band* band)
+{
+  const int src_size = band->count * band->loader->m_VertexSize;
+  const int dst_size = band->count * band->loader->m_native_vtx_decl.stride;
+  band->loaded = band->loader->RunVertices(DataReader(band->src, band->src + src_size),
+                                           DataReader(band->dst, band->dst + dst_size),
+                                           band->count);
+}
+
+int VertexLoaderWorkers::RunVertices(VertexLoaderBase* loader, DataReader src, DataReader dst,
+                                     int count)
+{
+  const int max_bands = std::max(count / MIN_VERTICES_PER_BAND, 1);
+  const int num_bands = std::min(static_cast<int>(m_worker_threads.size()) + 1, max_bands);
+  if (num_bands <= 1 || !loader->IsReentrant())
+    return loader->RunVertices(src, dst, count);
+
+  const u32 src_stride = loader->m_VertexSize;
+  const u32 dst_stride = loader->m_native_vtx_decl.stride;
+
+  // Spread the vertices as evenly as possible; the first bands get one extra vertex if needed.
+  m_bands.clear();
+  int first_vertex = 0;
+  for (int i = 0; i < num_bands; i++)
+  {
+    const int band_count = count / num_bands + (i < count % num_bands ? 1 : 0);
+    m_bands.push_back({loader, src.GetPointer() + first_vertex * src_stride,
+                       dst.GetPointer() + first_vertex * dst_stride, band_count, 0});
+    first_vertex += band_count;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    for (int i = 0; i < num_bands - 1; i++)
+      m_pending_bands.push_back(&m_bands[i]);
+    m_busy_bands += num_bands - 1;
+  }
+  m_worker_thread_wake.notify_all();
+
+  RunBand(&m_bands.back());
+
+  {
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_bands_done.wait(lock, [this] { return m_busy_bands == 0; });
+  }
+
+  // Every band wrote the positions of its own last vertices, in whichever order the threads
+  // finished. Convert the last vertices of the batch again, so the cache matches a single call.
+  m_scratch.resize(NUM_CACHED_POSITIONS * dst_stride);
+  u8* const last_vertices = src.GetPointer() + (count - NUM_CACHED_POSITIONS) * src_stride;
+  loader->RunVertices(
+      DataReader(last_vertices, last_vertices + NUM_CACHED_POSITIONS * src_stride),
+      DataReader(m_scratch.data(), m_scratch.data() + m_scratch.size()), NUM_CACHED_POSITIONS);
+  loader->m_numLoadedVertices -= NUM_CACHED_POSITIONS;
+
+  // Close the gaps left by skipped vertices, so the output is contiguous again.
+  u8* write_ptr = dst.GetPointer();
+  int loaded = 0;
+  for (const Band& band : m_bands)
+  {
+    if (write_ptr != band.dst)
+      std::memmove(write_ptr, band.dst, band.loaded * dst_stride);
+    write_ptr += band.loaded * dst_stride;
+    loaded += band.loaded;
+  }
+
+  return loaded;
+}
+
+void VertexLoaderWorkers::WorkerThreadRun()
+{
+  Common::SetCurrentThreadName("Vertex loader worker");
+
+  std::unique_lock<std::mutex> lock(m_lock);
+  while (true)
+  {
+    m_worker_thread_wake.wait(lock, [this] { return m_exit || !m_pending_bands.empty(); });
+    if (m_exit)
+      return;
+
+    Band* const band = m_pending_bands.back();
+    m_pending_bands.pop_back();
+    lock.unlock();
+
+    RunBand(band);
+
+    lock.lock();
+    if (--m_busy_bands == 0)
+      m_bands_done.notify_one();
+  }
+}
+}  // namespace VideoCommon
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class DataReader;
+class VertexLoaderBase;
+
+namespace VideoCommon
+{
+// Splits vertex conversion of large primitive batches across a set of worker threads.
+// Vertices are independent of each other, so each band of vertices can be converted with its own
+// call to the loader. The calling thread converts the last band itself, and then waits for the
+// workers to finish the remaining bands, so callers still see a synchronous conversion.
+// The bands are next to each other in the output, so reentrant loaders must not write past the
+// last attribute of a vertex.
+class VertexLoaderWorkers
+{
+public:
+  VertexLoaderWorkers();
+  ~VertexLoaderWorkers();
+
+  void ResizeWorkerThreads(u32 num_worker_threads);
+  bool HasWorkerThreads() const;
+
+  // Equivalent to loader->RunVertices(src, dst, count).
+  // Loaders which are not reentrant always run on the calling thread only.
+  int RunVertices(VertexLoaderBase* loader, DataReader src, DataReader dst, int count);
+
+private:
+  struct Band
+  {
+    VertexLoaderBase* loader;
+    u8* src;
+    u8* dst;
+    int count;
+    // Number of vertices written, which is less than count if the loader skipped any.
+    int loaded;
+  };
+
+  static void RunBand(Band* band);
+
+  void StopWorkerThreads();
+  void WorkerThreadRun();
+
+  std::vector<std::thread> m_worker_threads;
+
+  // Only used by the calling thread.
+  std::vector<Band> m_bands;
+  std::vector<u8> m_scratch;
+
+  std::mutex m_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::condition_variable m_bands_done;
+  std::vector<Band*> m_pending_bands;
+  u32 m_busy_bands = 0;
+  bool m_exit = false;
+};
+}  // namespace VideoCommon
@@ -248,9 +248,17 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
     MOVLPS(dest, coords);
     break;
   case 3:
-    MOVUPS(dest, coords);
+  {
+    // Don't store 16 bytes, which would overwrite the first component of the next vertex. That
+    // vertex may already have been written by another thread, see VertexLoaderWorkers.
+    MOVLPS(dest, coords);
+    MOVHLPS(XMM1, coords);
+    OpArg dest_z = dest;
+    dest_z.AddMemOffset(2 * sizeof(float));
+    MOVSS(dest_z, XMM1);
     break;
   }
+  }
 
   // zfreeze
   if (native_format == &m_native_vtx_decl.position)
@@ -518,7 +526,8 @@ void VertexLoaderX64::GenerateVertexLoader()
         PXOR(XMM0, R(XMM0));
         CVTSI2SS(XMM0, R(scratch1));
         SHUFPS(XMM0, R(XMM0), 0x45);  // 000X -> 0X00
-        MOVUPS(MDisp(dst_reg, m_dst_ofs), XMM0);
+        MOVLPS(MDisp(dst_reg, m_dst_ofs), XMM0);
+        MOV(32, MDisp(dst_reg, m_dst_ofs + 8), Imm32(0));
         m_dst_ofs += sizeof(float) * 3;
       }
     }
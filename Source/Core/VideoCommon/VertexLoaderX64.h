@@ -16,6 +16,7 @@ public:
 protected:
   std::string GetName() const override { return "VertexLoaderX64"; }
   bool IsInitialized() override { return true; }
+  bool IsReentrant() const override { return true; }
   int RunVertices(DataReader src, DataReader dst, int count) override;
 
 private:
@@ -29,6 +29,7 @@
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/SamplerCommon.h"
+#include "VideoCommon/StageTimers.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -129,7 +130,7 @@ DataReader VertexManagerBase::PrepareForAdditionalData(int primitive, u32 count,
                                          primitive_from_gx[primitive];
   if (m_current_primitive_type != new_primitive_type)
   {
-    Flush();
+    Flush(FlushReason::PrimitiveType);
 
     // Have to update the rasterization state for point/line cull modes.
     m_current_primitive_type = new_primitive_type;
@@ -141,7 +142,7 @@ DataReader VertexManagerBase::PrepareForAdditionalData(int primitive, u32 count,
       (count > m_index_generator.GetRemainingIndices() || count > GetRemainingIndices(primitive) ||
        needed_vertex_bytes > GetRemainingSize()))
   {
-    Flush();
+    Flush(FlushReason::BufferFull);
 
     if (count > m_index_generator.GetRemainingIndices())
     {
@@ -338,6 +339,8 @@ bool VertexManagerBase::UploadTexelBuffer(const void* data, u32 data_size, Texel
 
 void VertexManagerBase::LoadTextures()
 {
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::TextureCache);
+
   BitSet32 usedtextures;
   for (u32 i = 0; i < bpmem.genMode.numtevstages + 1u; ++i)
     if (bpmem.tevorders[i / 2].getEnable(i & 1))
@@ -354,12 +357,14 @@ void VertexManagerBase::LoadTextures()
   g_texture_cache->BindTextures();
 }
 
-void VertexManagerBase::Flush()
+void VertexManagerBase::Flush(FlushReason reason)
 {
   if (m_is_flushed)
     return;
 
   m_is_flushed = true;
+  INCSTAT(g_stats.this_frame.num_flushes[static_cast<size_t>(reason)]);
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::BackendSubmit);
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens ||
       xfmem.numChan.numColorChans != bpmem.genMode.numcolchans)
@@ -496,6 +501,8 @@ void VertexManagerBase::Flush()
 
       DrawCurrentBatch(base_index, num_indices, base_vertex);
       INCSTAT(g_stats.this_frame.num_draw_calls);
+      if (m_using_uber_shader_fallback)
+        INCSTAT(g_stats.this_frame.num_uber_shader_fallback_draws);
 
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
@@ -520,7 +527,7 @@ void VertexManagerBase::DoState(PointerWrap& p)
   if (p.GetMode() == PointerWrap::MODE_READ)
   {
     // Flush old vertex data before loading state.
-    Flush();
+    Flush(FlushReason::SaveState);
 
     // Clear all caches that touch RAM
     // (? these don't appear to touch any emulation state that gets saved. moved to on load only.)
@@ -677,8 +684,10 @@ void VertexManagerBase::UpdatePipelineObject()
   if (!m_pipeline_config_changed)
     return;
 
+  StageTimers::ScopedTimer stage_timer(StageTimers::Stage::ShaderLookup);
   m_current_pipeline_object = nullptr;
   m_pipeline_config_changed = false;
+  m_using_uber_shader_fallback = false;
 
   switch (g_ActiveConfig.iShaderCompilationMode)
   {
@@ -714,6 +723,7 @@ void VertexManagerBase::UpdatePipelineObject()
       // Specialized shaders not ready, use the ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_using_uber_shader_fallback = true;
     }
     else
     {
@@ -12,6 +12,7 @@
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/Statistics.h"
 
 class DataReader;
 class NativeVertexFormat;
@@ -98,7 +99,7 @@ public:
   DataReader PrepareForAdditionalData(int primitive, u32 count, u32 stride, bool cullall);
   void FlushData(u32 count, u32 stride);
 
-  void Flush();
+  void Flush(FlushReason reason);
 
   void DoState(PointerWrap& p);
 
@@ -182,6 +183,8 @@ protected:
   VideoCommon::GXPipelineUid m_current_pipeline_config;
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
+  // Set when the specialized pipeline is still compiling, and an ubershader is drawn instead.
+  bool m_using_uber_shader_fallback = false;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
   bool m_pipeline_config_changed = true;
   bool m_rasterization_state_changed = true;
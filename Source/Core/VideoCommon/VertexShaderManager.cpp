@@ -576,7 +576,7 @@ void VertexShaderManager::SetTexMatrixChangedA(u32 Value)
 {
   if (g_main_cp_state.matrix_index_a.Hex != Value)
   {
-    g_vertex_manager->Flush();
+    g_vertex_manager->Flush(FlushReason::MatrixIndex);
     if (g_main_cp_state.matrix_index_a.PosNormalMtxIdx != (Value & 0x3f))
       bPosNormalMatrixChanged = true;
     bTexMatricesChanged[0] = true;
@@ -588,7 +588,7 @@ void VertexShaderManager::SetTexMatrixChangedB(u32 Value)
 {
   if (g_main_cp_state.matrix_index_b.Hex != Value)
   {
-    g_vertex_manager->Flush();
+    g_vertex_manager->Flush(FlushReason::MatrixIndex);
     bTexMatricesChanged[1] = true;
     g_main_cp_state.matrix_index_b.Hex = Value;
   }
@@ -318,6 +318,9 @@ void VideoBackendBase::InitializeShared()
 
   g_Config.VerifyValidity();
   UpdateActiveConfig();
+
+  VertexLoaderManager::LoadDiskCache();
+  VertexLoaderManager::UpdateWorkerThreads();
 }
 
 void VideoBackendBase::ShutdownShared()
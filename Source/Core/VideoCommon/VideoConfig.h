@@ -93,9 +93,11 @@ struct VideoConfig final
   bool bShowNetPlayMessages;
   bool bOverlayStats;
   bool bOverlayProjStats;
+  bool bOverlayStageTimes;
   bool bTexFmtOverlayEnable;
   bool bTexFmtOverlayCenter;
   bool bLogRenderTimeToFile;
+  bool bLogStageTimesToFile;
 
   // Render
   bool bWireFrame;
@@ -125,6 +127,7 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable;
   bool bEFBAccessDeferInvalidation;
+  bool bEFBAccessPredictiveReadback;
   bool bPerfQueriesEnable;
   bool bBBoxEnable;
   bool bForceProgressive;
@@ -143,6 +146,7 @@ struct VideoConfig final
   bool bFastDepthCalc;
   bool bVertexRounding;
   int iEFBAccessTileSize;
+  int iEFBAccessMaxStaleFrames;
   int iLog;           // CONF_ bits
   int iSaveTargetId;  // TODO: Should be dropped
 
@@ -187,6 +191,16 @@ struct VideoConfig final
   int iShaderCompilerThreads;
   int iShaderPrecompilerThreads;
 
+  // Number of worker threads used to decode large textures on the CPU.
+  // 0 decodes on the GPU thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecoderThreads;
+
+  // Number of worker threads used to convert large primitive batches.
+  // 0 converts on the GPU thread only.
+  // -1 uses an automatic number based on the CPU threads.
+  int iVertexLoaderThreads;
+
   // Static config per API
   // TODO: Move this out of VideoConfig
   struct
@@ -251,6 +265,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecoderThreads() const;
+  u32 GetVertexLoaderThreads() const;
 };
 
 extern VideoConfig g_Config;
@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
@@ -13,16 +15,31 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/XFMemory.h"
 
 static void XFMemWritten(u32 transferSize, u32 baseAddress)
 {
-  g_vertex_manager->Flush();
+  g_vertex_manager->Flush(FlushReason::XFMemory);
   VertexShaderManager::InvalidateXFRange(baseAddress, baseAddress + transferSize);
 }
 
+// Games often reload the same matrices and viewport for every object, which doesn't need to split
+// the current batch.
+static bool XFDataChanged(u32 address, u32 size, const DataReader& src, u32 data_index)
+{
+  for (u32 i = 0; i < size; i++)
+  {
+    if (((u32*)&xfmem)[address + i] != src.Peek<u32>((data_index + i) * sizeof(u32)))
+      return true;
+  }
+
+  INCSTAT(g_stats.this_frame.num_redundant_state_writes);
+  return false;
+}
+
 static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
 {
   u32 address = baseAddress;
@@ -33,6 +50,12 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     u32 newValue = src.Peek<u32>(dataIndex * sizeof(u32));
     u32 nextAddress = address + 1;
 
+    // Registers that are written as a group, from the current one up to group_end.
+    const auto group_changed = [&](u32 group_end) {
+      const u32 size = std::min<u32>(group_end - address, static_cast<u32>(transferSize));
+      return XFDataChanged(address, size, src, dataIndex);
+    };
+
     switch (address)
     {
     case XFMEM_ERROR:
@@ -55,7 +78,7 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
 
     case XFMEM_SETNUMCHAN:
       if (xfmem.numChan.numColorChans != (newValue & 3))
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
@@ -65,7 +88,7 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
       u8 chan = address - XFMEM_SETCHAN0_AMBCOLOR;
       if (xfmem.ambColor[chan] != newValue)
       {
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
         VertexShaderManager::SetMaterialColorChanged(chan);
       }
       break;
@@ -77,7 +100,7 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
       u8 chan = address - XFMEM_SETCHAN0_MATCOLOR;
       if (xfmem.matColor[chan] != newValue)
       {
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
         VertexShaderManager::SetMaterialColorChanged(chan + 2);
       }
       break;
@@ -88,13 +111,13 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETCHAN0_ALPHA:  // Channel Alpha
     case XFMEM_SETCHAN1_ALPHA:
       if (((u32*)&xfmem)[address] != (newValue & 0x7fff))
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
     case XFMEM_DUALTEX:
       if (xfmem.dualTexTrans.enabled != (newValue & 1))
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
       VertexShaderManager::SetTexMatrixInfoChanged(-1);
       break;
 
@@ -111,10 +134,13 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetViewportChanged();
-      PixelShaderManager::SetViewportChanged();
-      GeometryShaderManager::SetViewportChanged();
+      if (group_changed(XFMEM_SETVIEWPORT + 6))
+      {
+        g_vertex_manager->Flush(FlushReason::XFRegister);
+        VertexShaderManager::SetViewportChanged();
+        PixelShaderManager::SetViewportChanged();
+        GeometryShaderManager::SetViewportChanged();
+      }
 
       nextAddress = XFMEM_SETVIEWPORT + 6;
       break;
@@ -126,16 +152,19 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetProjectionChanged();
-      GeometryShaderManager::SetProjectionChanged();
+      if (group_changed(XFMEM_SETPROJECTION + 7))
+      {
+        g_vertex_manager->Flush(FlushReason::XFRegister);
+        VertexShaderManager::SetProjectionChanged();
+        GeometryShaderManager::SetProjectionChanged();
+      }
 
       nextAddress = XFMEM_SETPROJECTION + 7;
       break;
 
     case XFMEM_SETNUMTEXGENS:  // GXSetNumTexGens
       if (xfmem.numTexGen.numTexGens != (newValue & 15))
-        g_vertex_manager->Flush();
+        g_vertex_manager->Flush(FlushReason::XFRegister);
       break;
 
     case XFMEM_SETTEXMTXINFO:
@@ -146,8 +175,11 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
+      if (group_changed(XFMEM_SETTEXMTXINFO + 8))
+      {
+        g_vertex_manager->Flush(FlushReason::XFRegister);
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
+      }
 
       nextAddress = XFMEM_SETTEXMTXINFO + 8;
       break;
@@ -160,8 +192,11 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
+      if (group_changed(XFMEM_SETPOSTMTXINFO + 8))
+      {
+        g_vertex_manager->Flush(FlushReason::XFRegister);
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
+      }
 
       nextAddress = XFMEM_SETPOSTMTXINFO + 8;
       break;
@@ -235,10 +270,17 @@ void LoadXFReg(u32 transferSize, u32 baseAddress, DataReader src)
       transferSize = 0;
     }
 
-    XFMemWritten(xfMemTransferSize, xfMemBase);
-    for (u32 i = 0; i < xfMemTransferSize; i++)
+    if (XFDataChanged(xfMemBase, xfMemTransferSize, src, 0))
+    {
+      XFMemWritten(xfMemTransferSize, xfMemBase);
+      for (u32 i = 0; i < xfMemTransferSize; i++)
+      {
+        ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      }
+    }
+    else
     {
-      ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      src.Skip<u32>(xfMemTransferSize);
     }
   }
 
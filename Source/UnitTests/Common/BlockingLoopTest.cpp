@@ -9,9 +9,10 @@
 
 #include "Common/BlockingLoop.h"
 
-TEST(BlockingLoop, MultiThreaded)
+static void TestMultiThreaded(bool adaptive_spin)
 {
   Common::BlockingLoop loop;
+  loop.SetAdaptiveSpin(adaptive_spin);
   std::atomic<int> signaled_a(0);
   std::atomic<int> received_a(0);
   std::atomic<int> signaled_b(0);
@@ -78,3 +79,13 @@ TEST(BlockingLoop, MultiThreaded)
     loop_thread.join();
   }
 }
+
+TEST(BlockingLoop, MultiThreaded)
+{
+  TestMultiThreaded(false);
+}
+
+TEST(BlockingLoop, MultiThreadedAdaptiveSpin)
+{
+  TestMultiThreaded(true);
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+static void DoTestState(PointerWrap& p, u32& value, std::string& text)
+{
+  p.Do(value);
+  p.Do(text);
+  p.DoMarker("Test");
+}
+
+TEST(ChunkFile, BoundedWriteAndRead)
+{
+  u32 value = 0x12345678;
+  std::string text = "savestate";
+
+  std::array<u8, 64> buffer{};
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::MODE_WRITE);
+  DoTestState(p, value, text);
+  EXPECT_EQ(PointerWrap::MODE_WRITE, p.GetMode());
+  const size_t size = static_cast<size_t>(ptr - buffer.data());
+
+  u32 read_value = 0;
+  std::string read_text;
+  ptr = buffer.data();
+  PointerWrap read_p(&ptr, size, PointerWrap::MODE_READ);
+  DoTestState(read_p, read_value, read_text);
+  EXPECT_EQ(PointerWrap::MODE_READ, read_p.GetMode());
+  EXPECT_EQ(value, read_value);
+  EXPECT_EQ(text, read_text);
+}
+
+TEST(ChunkFile, WriteOverflowMeasuresSize)
+{
+  u32 value = 0x12345678;
+  std::string text = "a string that doesn't fit";
+
+  u8* ptr = nullptr;
+  PointerWrap measure_p(&ptr, PointerWrap::MODE_MEASURE);
+  DoTestState(measure_p, value, text);
+  const size_t needed_size = reinterpret_cast<size_t>(ptr);
+
+  // The bytes past the end of the buffer must not be touched.
+  std::vector<u8> buffer(needed_size, 0xcc);
+  ptr = buffer.data();
+  PointerWrap p(&ptr, 8, PointerWrap::MODE_WRITE);
+  DoTestState(p, value, text);
+  EXPECT_EQ(PointerWrap::MODE_MEASURE, p.GetMode());
+  EXPECT_EQ(needed_size, static_cast<size_t>(ptr - buffer.data()));
+  for (size_t i = 8; i < buffer.size(); ++i)
+    EXPECT_EQ(0xcc, buffer[i]);
+}
+
+TEST(ChunkFile, TruncatedRead)
+{
+  u32 value = 0x12345678;
+  std::string text = "savestate";
+
+  std::vector<u8> buffer(64);
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::MODE_WRITE);
+  DoTestState(p, value, text);
+  const size_t size = static_cast<size_t>(ptr - buffer.data());
+
+  u32 read_value = 0;
+  std::string read_text;
+  ptr = buffer.data();
+  PointerWrap read_p(&ptr, size - 1, PointerWrap::MODE_READ);
+  DoTestState(read_p, read_value, read_text);
+  EXPECT_EQ(PointerWrap::MODE_MEASURE, read_p.GetMode());
+}
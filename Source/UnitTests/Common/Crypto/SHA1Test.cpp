@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <mbedtls/sha1.h>
+
+#include "Common/Crypto/SHA1.h"
+
+static Common::SHA1::Digest ReferenceDigest(const u8* data, size_t size)
+{
+  Common::SHA1::Digest digest;
+  mbedtls_sha1_ret(data, size, digest.data());
+  return digest;
+}
+
+TEST(SHA1, KnownDigest)
+{
+  static constexpr char MESSAGE[] = "abc";
+  static constexpr Common::SHA1::Digest EXPECTED{{0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81,
+                                                  0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50,
+                                                  0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d}};
+  const u8* message = reinterpret_cast<const u8*>(MESSAGE);
+  EXPECT_EQ(EXPECTED, Common::SHA1::CalculateDigest(message, sizeof(MESSAGE) - 1));
+}
+
+TEST(SHA1, MatchesMbedtls)
+{
+  std::vector<u8> data(4096);
+  std::iota(data.begin(), data.end(), u8(0));
+
+  // Covers every way the padding can end up, and messages of many blocks.
+  for (size_t size = 0; size <= data.size(); size += size < 200 ? 1 : 61)
+  {
+    EXPECT_EQ(ReferenceDigest(data.data(), size), Common::SHA1::CalculateDigest(data.data(), size))
+        << fmt::format("size {}", size);
+  }
+}
+
+TEST(SHA1, SplitUpdates)
+{
+  std::vector<u8> data(1000);
+  std::iota(data.begin(), data.end(), u8(7));
+
+  for (size_t split : {1, 63, 64, 65, 500})
+  {
+    Common::SHA1::Context context;
+    for (size_t offset = 0; offset < data.size(); offset += split)
+      context.Update(data.data() + offset, std::min(split, data.size() - offset));
+    EXPECT_EQ(ReferenceDigest(data.data(), data.size()), context.Finish())
+        << fmt::format("split {}", split);
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the SHA1 implementation, using the time gtest
+// reports.
+TEST(SHA1SpeedTest, DISABLED_Throughput)
+{
+  // The size of the H0 hashes of Wii discs, which is what most of the hashing is spent on.
+  constexpr size_t HASHED_SIZE = 0x400;
+  std::vector<u8> data(4 * 1024 * 1024);
+  std::iota(data.begin(), data.end(), u8(0));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    for (size_t offset = 0; offset < data.size(); offset += HASHED_SIZE)
+      Common::SHA1::CalculateDigest(data.data() + offset, HASHED_SIZE);
+  }
+}
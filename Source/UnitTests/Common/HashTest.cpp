@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <numeric>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include "Common/Hash.h"
+
+TEST(Hash, CRC32MatchesZlib)
+{
+  std::vector<u8> data(4096);
+  std::iota(data.begin(), data.end(), u8(3));
+
+  for (size_t size = 0; size <= data.size(); size += size < 300 ? 1 : 97)
+  {
+    const u32 expected = crc32(crc32(0, nullptr, 0), data.data(), static_cast<unsigned int>(size));
+    EXPECT_EQ(expected, Common::UpdateCRC32(0, data.data(), size)) << fmt::format("size {}", size);
+  }
+}
+
+TEST(Hash, CRC32SplitUpdates)
+{
+  std::vector<u8> data(10000);
+  std::iota(data.begin(), data.end(), u8(5));
+  const u32 expected = Common::UpdateCRC32(0, data.data(), data.size());
+
+  for (size_t split : {1, 15, 64, 100, 4096})
+  {
+    u32 crc = 0;
+    for (size_t offset = 0; offset < data.size(); offset += split)
+      crc = Common::UpdateCRC32(crc, data.data() + offset, std::min(split, data.size() - offset));
+    EXPECT_EQ(expected, crc) << fmt::format("split {}", split);
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the CRC32, using the time gtest reports.
+TEST(HashSpeedTest, DISABLED_CRC32)
+{
+  std::vector<u8> data(4 * 1024 * 1024);
+  std::iota(data.begin(), data.end(), u8(0));
+
+  for (int i = 0; i < 4; ++i)
+    Common::UpdateCRC32(0, data.data(), data.size());
+}
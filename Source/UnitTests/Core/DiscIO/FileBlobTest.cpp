@@ -0,0 +1,145 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/FileBlob.h"
+
+namespace
+{
+constexpr u64 FILE_SIZE = 8 * 1024 * 1024;
+
+// The usual size of DVD reads to emulated RAM.
+constexpr u32 READ_SIZE = 32 * 1024;
+}  // namespace
+
+class FileBlobTest : public testing::Test
+{
+protected:
+  FileBlobTest() : m_temp_dir(File::CreateTempDir())
+  {
+    m_path = m_temp_dir + "/disc.iso";
+
+    m_data.resize(FILE_SIZE);
+    std::mt19937 random;
+    std::generate(m_data.begin(), m_data.end(), [&random] { return static_cast<u8>(random()); });
+
+    File::IOFile file(m_path, "wb");
+    file.WriteBytes(m_data.data(), m_data.size());
+  }
+
+  ~FileBlobTest() override { File::DeleteDirRecursively(m_temp_dir); }
+
+  std::unique_ptr<DiscIO::PlainFileReader> CreateReader() const
+  {
+    return DiscIO::PlainFileReader::Create(File::IOFile(m_path, "rb"));
+  }
+
+  std::string m_temp_dir;
+  std::string m_path;
+  std::vector<u8> m_data;
+};
+
+TEST_F(FileBlobTest, Read)
+{
+  const auto reader = CreateReader();
+  ASSERT_TRUE(reader);
+  ASSERT_EQ(FILE_SIZE, reader->GetDataSize());
+
+  std::vector<u8> buffer(READ_SIZE);
+  for (u64 offset : {u64(0), u64(1), u64(0x12345), FILE_SIZE - READ_SIZE})
+  {
+    ASSERT_TRUE(reader->Read(offset, READ_SIZE, buffer.data()));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), m_data.begin() + offset))
+        << fmt::format("offset {:#x}", offset);
+  }
+
+  EXPECT_FALSE(reader->Read(FILE_SIZE - READ_SIZE + 1, READ_SIZE, buffer.data()));
+  EXPECT_FALSE(reader->Read(FILE_SIZE + 1, 0, buffer.data()));
+}
+
+TEST_F(FileBlobTest, GetMappedData)
+{
+  const auto reader = CreateReader();
+  ASSERT_TRUE(reader);
+
+  // Memory mapping is optional, but where it works, the mapping must match the file.
+  const u8* data = reader->GetMappedData(0x8000, READ_SIZE);
+  if (!data)
+    return;
+
+  EXPECT_EQ(0, std::memcmp(data, m_data.data() + 0x8000, READ_SIZE));
+  EXPECT_EQ(data + READ_SIZE, reader->GetMappedData(0x8000 + READ_SIZE, READ_SIZE));
+  EXPECT_EQ(nullptr, reader->GetMappedData(FILE_SIZE - READ_SIZE + 1, READ_SIZE));
+  EXPECT_EQ(nullptr, reader->GetMappedData(FILE_SIZE + 1, 0));
+}
+
+// Run with --gtest_also_run_disabled_tests to compare the ways of serving DVD reads to RAM, using
+// the time gtest reports. The file was just written, so this measures reads from the page cache.
+class FileBlobSpeedTest : public FileBlobTest
+{
+protected:
+  // Copies READ_SIZE bytes at sequential and then random offsets into a buffer standing in for
+  // emulated RAM, the way DVDThread serves reads to RAM.
+  template <typename ReadFunction>
+  void ReadAll(ReadFunction read)
+  {
+    constexpr size_t num_reads = 4 * FILE_SIZE / READ_SIZE;
+    std::mt19937 random;
+    std::uniform_int_distribution<u64> distribution(0, FILE_SIZE / READ_SIZE - 1);
+
+    std::vector<u8> ram(READ_SIZE);
+    for (size_t i = 0; i < num_reads; i++)
+      ASSERT_TRUE(read(i * READ_SIZE % FILE_SIZE, ram.data()));
+    for (size_t i = 0; i < num_reads; i++)
+      ASSERT_TRUE(read(distribution(random) * READ_SIZE, ram.data()));
+  }
+};
+
+// What PlainFileReader and DVDThread used to do: read into a temporary buffer, then copy.
+TEST_F(FileBlobSpeedTest, DISABLED_IOFileReadAndCopy)
+{
+  File::IOFile file(m_path, "rb");
+  ReadAll([&](u64 offset, u8* ram) {
+    std::vector<u8> buffer(READ_SIZE);
+    if (!file.Seek(offset, SEEK_SET) || !file.ReadBytes(buffer.data(), READ_SIZE))
+      return false;
+    std::copy(buffer.begin(), buffer.end(), ram);
+    return true;
+  });
+}
+
+TEST_F(FileBlobSpeedTest, DISABLED_PlainFileReaderRead)
+{
+  const auto reader = CreateReader();
+  ASSERT_TRUE(reader);
+  ReadAll([&](u64 offset, u8* ram) { return reader->Read(offset, READ_SIZE, ram); });
+}
+
+TEST_F(FileBlobSpeedTest, DISABLED_MappedCopy)
+{
+  const auto reader = CreateReader();
+  ASSERT_TRUE(reader);
+  if (!reader->GetMappedData(0, READ_SIZE))
+    return;
+
+  ReadAll([&](u64 offset, u8* ram) {
+    const u8* data = reader->GetMappedData(offset, READ_SIZE);
+    if (!data)
+      return false;
+    std::copy(data, data + READ_SIZE, ram);
+    return true;
+  });
+}
@@ -0,0 +1,262 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/StateCompression.h"
+
+using namespace State;
+
+namespace
+{
+// Roughly the layout of a GameCube state, with a large HW section for MEM1
+constexpr StateSectionSizes SECTION_SIZES{
+    {700 * 1024, 4096, 2048, 3 * 1024 * 1024 + 4096, 512, 16}};
+
+struct TestState
+{
+  std::vector<u8> data;
+  StateSectionSizes section_sizes;
+};
+
+// Fills a state with compressible data
+TestState CreateState(const StateSectionSizes& section_sizes, std::mt19937& rng)
+{
+  TestState state{{}, section_sizes};
+  for (const u32 section_size : section_sizes)
+  {
+    for (u32 i = 0; i < section_size; ++i)
+      state.data.push_back(static_cast<u8>(rng() % 16));
+  }
+  return state;
+}
+
+std::shared_ptr<const CompressedState>
+Compress(const TestState& state, std::shared_ptr<const StateDictionary> dictionary,
+         std::shared_ptr<const CompressedState> previous)
+{
+  StateCompressor compressor(state.data.data(), state.data.size(), std::move(dictionary),
+                             std::move(previous));
+  size_t section_end = 0;
+  for (const u32 section_size : state.section_sizes)
+  {
+    section_end += section_size;
+    compressor.EndSection(section_end);
+  }
+  return compressor.Finish();
+}
+
+std::shared_ptr<const StateDictionary> CreateDictionary(const TestState& state)
+{
+  auto dictionary = std::make_shared<StateDictionary>();
+  dictionary->data = state.data;
+  return dictionary;
+}
+
+// Grows or shrinks the first section, like the video backend section does
+void ResizeFirstSection(TestState* state, s32 growth, std::mt19937& rng)
+{
+  const u32 old_size = state->section_sizes[0];
+  state->section_sizes[0] += growth;
+  if (growth > 0)
+  {
+    std::vector<u8> added(growth);
+    for (u8& value : added)
+      value = static_cast<u8>(rng() % 16);
+    state->data.insert(state->data.begin() + old_size, added.begin(), added.end());
+  }
+  else
+  {
+    state->data.erase(state->data.begin() + old_size + growth, state->data.begin() + old_size);
+  }
+}
+
+void ExpectDecompressesTo(const CompressedState& compressed, const TestState& state)
+{
+  std::vector<u8> data(state.data.size());
+  ASSERT_TRUE(DecompressState(compressed, data.data(), data.size()));
+  EXPECT_EQ(state.data, data);
+}
+// Consecutive states of a game that keeps running, which change a little in the HW section and
+// sometimes change the size of the first section
+std::vector<TestState> CreateHistory(size_t count, std::mt19937& rng)
+{
+  std::vector<TestState> states{CreateState(SECTION_SIZES, rng)};
+  const size_t hw_offset = SECTION_SIZES[0] + SECTION_SIZES[1] + SECTION_SIZES[2];
+  while (states.size() < count)
+  {
+    TestState state = states.back();
+    state.data[hw_offset + rng() % SECTION_SIZES[3]] ^= 0xff;
+    if (states.size() % 3 == 0)
+      ResizeFirstSection(&state, states.size() % 2 ? 16 * 1024 : -8 * 1024, rng);
+    states.push_back(std::move(state));
+  }
+  return states;
+}
+}  // namespace
+
+TEST(StateCompression, RoundTrip)
+{
+  std::mt19937 rng(0);
+  const TestState state = CreateState(SECTION_SIZES, rng);
+
+  const auto compressed = Compress(state, nullptr, nullptr);
+  ASSERT_NE(nullptr, compressed);
+  ExpectDecompressesTo(*compressed, state);
+
+  const auto dictionary = CreateDictionary(state);
+  const auto compressed_with_dictionary = Compress(state, dictionary, nullptr);
+  ASSERT_NE(nullptr, compressed_with_dictionary);
+  ExpectDecompressesTo(*compressed_with_dictionary, state);
+}
+
+TEST(StateCompression, ReusesUnchangedChunks)
+{
+  std::mt19937 rng(0);
+  TestState state = CreateState(SECTION_SIZES, rng);
+  const auto dictionary = CreateDictionary(state);
+  const auto first = Compress(state, dictionary, nullptr);
+  ASSERT_NE(nullptr, first);
+
+  // Change the first chunk of the HW section
+  const size_t hw_offset = SECTION_SIZES[0] + SECTION_SIZES[1] + SECTION_SIZES[2];
+  state.data[hw_offset] ^= 0xff;
+  const auto second = Compress(state, dictionary, first);
+  ASSERT_NE(nullptr, second);
+  ExpectDecompressesTo(*second, state);
+
+  ASSERT_EQ(first->chunks.size(), second->chunks.size());
+  size_t num_shared = 0;
+  for (size_t i = 0; i < first->chunks.size(); ++i)
+    num_shared += first->chunks[i].data == second->chunks[i].data;
+  EXPECT_EQ(first->chunks.size() - 1, num_shared);
+}
+
+// The video backend section changes size between states, e.g. with the number of EFB copies in the
+// texture cache. This moves the unchanged chunks after it, which then have to be compressed against
+// their new range of the dictionary.
+TEST(StateCompression, EarlierSectionChangesSize)
+{
+  std::mt19937 rng(0);
+  const TestState first_state = CreateState(SECTION_SIZES, rng);
+  const auto dictionary = CreateDictionary(first_state);
+  const auto first = Compress(first_state, dictionary, nullptr);
+  ASSERT_NE(nullptr, first);
+
+  for (const s32 growth : {48 * 1024, -48 * 1024})
+  {
+    TestState second_state = first_state;
+    ResizeFirstSection(&second_state, growth, rng);
+
+    const auto second = Compress(second_state, dictionary, first);
+    ASSERT_NE(nullptr, second);
+    ExpectDecompressesTo(*second, second_state);
+
+    // The next state is unchanged, so it can take all chunks from this one.
+    const auto third = Compress(second_state, dictionary, second);
+    ASSERT_NE(nullptr, third);
+    ExpectDecompressesTo(*third, second_state);
+    for (size_t i = 0; i < second->chunks.size(); ++i)
+      EXPECT_EQ(second->chunks[i].data, third->chunks[i].data);
+  }
+}
+
+TEST(StateHistory, GetsEveryState)
+{
+  std::mt19937 rng(0);
+  // More than one group
+  const std::vector<TestState> states = CreateHistory(40, rng);
+  StateHistory history(1024 * 1024 * 1024);
+  for (size_t i = 0; i < states.size(); ++i)
+    ASSERT_TRUE(history.Add(i * 10, states[i].data.data(), states[i].section_sizes));
+
+  for (size_t i = 0; i < states.size(); ++i)
+  {
+    std::vector<u8> data;
+    EXPECT_EQ(std::optional<s64>(i * 10), history.Get(i * 10 + 5, &data));
+    EXPECT_EQ(states[i].data, data);
+  }
+
+  std::vector<u8> data;
+  EXPECT_EQ(std::nullopt, history.Get(-1, &data));
+}
+
+TEST(StateHistory, ContinuesAfterOlderState)
+{
+  std::mt19937 rng(0);
+  const std::vector<TestState> states = CreateHistory(40, rng);
+  StateHistory history(1024 * 1024 * 1024);
+  for (size_t i = 0; i < states.size(); ++i)
+    ASSERT_TRUE(history.Add(i, states[i].data.data(), states[i].section_sizes));
+
+  // Go back into the first group, and continue from there with different states.
+  std::vector<u8> data;
+  ASSERT_EQ(std::optional<s64>(10), history.Get(10, &data));
+  history.DropAfter(10);
+  EXPECT_EQ(std::optional<s64>(10), history.Get(20, &data));
+
+  const std::vector<TestState> new_states = CreateHistory(5, rng);
+  for (size_t i = 0; i < new_states.size(); ++i)
+    ASSERT_TRUE(history.Add(11 + i, new_states[i].data.data(), new_states[i].section_sizes));
+  for (size_t i = 0; i <= 10; ++i)
+  {
+    ASSERT_EQ(std::optional<s64>(i), history.Get(i, &data));
+    EXPECT_EQ(states[i].data, data);
+  }
+  for (size_t i = 0; i < new_states.size(); ++i)
+  {
+    ASSERT_EQ(std::optional<s64>(11 + i), history.Get(11 + i, &data));
+    EXPECT_EQ(new_states[i].data, data);
+  }
+}
+
+TEST(StateHistory, CountsLoadedKeyframe)
+{
+  std::mt19937 rng(0);
+  const std::vector<TestState> states = CreateHistory(40, rng);
+  StateHistory history(1024 * 1024 * 1024);
+  for (size_t i = 0; i < states.size(); ++i)
+    ASSERT_TRUE(history.Add(i, states[i].data.data(), states[i].section_sizes));
+  const size_t memory_usage = history.GetMemoryUsage();
+
+  // Loading from the first group decompresses its first state, which is kept until DropAfter().
+  std::vector<u8> data;
+  ASSERT_EQ(std::optional<s64>(10), history.Get(10, &data));
+  EXPECT_EQ(memory_usage + states[0].data.size(), history.GetMemoryUsage());
+  history.DropAfter(states.size() - 1);
+  EXPECT_EQ(memory_usage, history.GetMemoryUsage());
+
+  // The newest group keeps its first state anyway.
+  ASSERT_EQ(std::optional<s64>(35), history.Get(35, &data));
+  EXPECT_EQ(memory_usage, history.GetMemoryUsage());
+}
+
+TEST(StateHistory, DropsOldestGroups)
+{
+  std::mt19937 rng(0);
+  const std::vector<TestState> states = CreateHistory(100, rng);
+  StateHistory history(1024 * 1024 * 1024);
+  for (size_t i = 0; i < 32; ++i)
+    ASSERT_TRUE(history.Add(i, states[i].data.data(), states[i].section_sizes));
+
+  // Enough for a little more than one group
+  const size_t memory_limit = history.GetMemoryUsage() * 3 / 2;
+  history.SetMemoryLimit(memory_limit);
+  for (size_t i = 32; i < states.size(); ++i)
+  {
+    ASSERT_TRUE(history.Add(i, states[i].data.data(), states[i].section_sizes));
+    EXPECT_LE(history.GetMemoryUsage(), memory_limit * 2);
+  }
+
+  std::vector<u8> data;
+  EXPECT_EQ(std::nullopt, history.Get(0, &data));
+  ASSERT_EQ(std::optional<s64>(99), history.Get(99, &data));
+  EXPECT_EQ(states[99].data, data);
+}
@@ -0,0 +1,214 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+constexpr u16 PRIMITIVE_RESTART = UINT16_MAX;
+
+// Triangle strips without primitive restart use up to 3 indices per vertex.
+constexpr u32 MAX_INDICES_PER_VERTEX = 3;
+
+// Checked for stray writes after the generated indices.
+constexpr size_t GUARD_SIZE = 64;
+constexpr u16 GUARD_VALUE = 0xDEAD;
+
+using Triangle = std::array<u16, 3>;
+
+// Rotates the triangle so that the smallest index comes first, which keeps the winding.
+Triangle Canonical(u16 a, u16 b, u16 c)
+{
+  if (b < a && b < c)
+    return {b, c, a};
+  if (c < a && c < b)
+    return {c, a, b};
+  return {a, b, c};
+}
+
+// The triangles to draw for a GX primitive, by the GX rules.
+std::vector<Triangle> ExpectedTriangles(int primitive, u32 num_verts, u32 base)
+{
+  std::vector<Triangle> triangles;
+  const auto add = [&](u32 a, u32 b, u32 c) {
+    triangles.push_back(Canonical(base + a, base + b, base + c));
+  };
+
+  switch (primitive)
+  {
+  case OpcodeDecoder::GX_DRAW_QUADS:
+    for (u32 i = 0; i + 4 <= num_verts; i += 4)
+    {
+      add(i, i + 1, i + 2);
+      add(i, i + 2, i + 3);
+    }
+    if (num_verts % 4 == 3)
+      add(num_verts - 3, num_verts - 2, num_verts - 1);
+    break;
+  case OpcodeDecoder::GX_DRAW_TRIANGLES:
+    for (u32 i = 0; i + 3 <= num_verts; i += 3)
+      add(i, i + 1, i + 2);
+    break;
+  case OpcodeDecoder::GX_DRAW_TRIANGLE_STRIP:
+    for (u32 i = 2; i < num_verts; i++)
+    {
+      if (i % 2 == 0)
+        add(i - 2, i - 1, i);
+      else
+        add(i - 2, i, i - 1);
+    }
+    break;
+  case OpcodeDecoder::GX_DRAW_TRIANGLE_FAN:
+    for (u32 i = 2; i < num_verts; i++)
+      add(0, i - 1, i);
+    break;
+  }
+
+  return triangles;
+}
+
+// Decodes an index buffer as a triangle list, or as strips separated by restart indices.
+std::vector<Triangle> DecodeTriangles(const u16* indices, u32 num_indices, bool primitive_restart)
+{
+  std::vector<Triangle> triangles;
+  if (!primitive_restart)
+  {
+    for (u32 i = 0; i + 3 <= num_indices; i += 3)
+      triangles.push_back(Canonical(indices[i], indices[i + 1], indices[i + 2]));
+    return triangles;
+  }
+
+  u32 strip_start = 0;
+  for (u32 i = 0; i < num_indices; i++)
+  {
+    if (indices[i] == PRIMITIVE_RESTART)
+    {
+      strip_start = i + 1;
+      continue;
+    }
+    if (i < strip_start + 2)
+      continue;
+
+    if ((i - strip_start) % 2 == 0)
+      triangles.push_back(Canonical(indices[i - 2], indices[i - 1], indices[i]));
+    else
+      triangles.push_back(Canonical(indices[i - 2], indices[i], indices[i - 1]));
+  }
+  return triangles;
+}
+
+std::vector<Triangle> Sorted(std::vector<Triangle> triangles)
+{
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+}  // namespace
+
+class IndexGeneratorTest : public testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    m_old_primitive_restart = g_Config.backend_info.bSupportsPrimitiveRestart;
+    g_Config.backend_info.bSupportsPrimitiveRestart = GetParam();
+    m_generator.Init();
+  }
+
+  void TearDown() override
+  {
+    g_Config.backend_info.bSupportsPrimitiveRestart = m_old_primitive_restart;
+  }
+
+  // Draws the primitive after a strip of a few vertices, so the base index isn't zero.
+  void CheckPrimitive(int primitive, u32 num_verts)
+  {
+    constexpr u32 leading_verts = 5;
+    std::vector<u16> buffer((leading_verts + num_verts) * MAX_INDICES_PER_VERTEX + GUARD_SIZE,
+                            GUARD_VALUE);
+    m_generator.Start(buffer.data());
+    m_generator.AddIndices(OpcodeDecoder::GX_DRAW_TRIANGLE_STRIP, leading_verts);
+    const u32 leading_indices = m_generator.GetIndexLen();
+    m_generator.AddIndices(primitive, num_verts);
+
+    const u32 num_indices = m_generator.GetIndexLen() - leading_indices;
+    ASSERT_LE(leading_indices + num_indices, buffer.size() - GUARD_SIZE);
+    for (size_t i = leading_indices + num_indices; i < buffer.size(); i++)
+      ASSERT_EQ(GUARD_VALUE, buffer[i]) << fmt::format("wrote past the end at {}", i);
+    ASSERT_EQ(leading_verts + num_verts, m_generator.GetNumVerts());
+
+    EXPECT_EQ(Sorted(ExpectedTriangles(primitive, num_verts, leading_verts)),
+              Sorted(DecodeTriangles(buffer.data() + leading_indices, num_indices, GetParam())))
+        << fmt::format("primitive {}, {} vertices", primitive, num_verts);
+  }
+
+  IndexGenerator m_generator;
+  bool m_old_primitive_restart = false;
+};
+
+TEST_P(IndexGeneratorTest, Quads)
+{
+  for (u32 num_verts = 0; num_verts < 200; num_verts++)
+    CheckPrimitive(OpcodeDecoder::GX_DRAW_QUADS, num_verts);
+}
+
+TEST_P(IndexGeneratorTest, Triangles)
+{
+  for (u32 num_verts = 0; num_verts < 200; num_verts++)
+    CheckPrimitive(OpcodeDecoder::GX_DRAW_TRIANGLES, num_verts);
+}
+
+TEST_P(IndexGeneratorTest, TriangleStrip)
+{
+  for (u32 num_verts = 0; num_verts < 200; num_verts++)
+    CheckPrimitive(OpcodeDecoder::GX_DRAW_TRIANGLE_STRIP, num_verts);
+}
+
+TEST_P(IndexGeneratorTest, TriangleFan)
+{
+  for (u32 num_verts = 0; num_verts < 200; num_verts++)
+    CheckPrimitive(OpcodeDecoder::GX_DRAW_TRIANGLE_FAN, num_verts);
+}
+
+INSTANTIATE_TEST_CASE_P(PrimitiveRestart, IndexGeneratorTest, testing::Bool());
+
+// Run with --gtest_also_run_disabled_tests to measure the generator, using the time gtest reports.
+class IndexGeneratorSpeedTest : public IndexGeneratorTest
+{
+};
+INSTANTIATE_TEST_CASE_P(PrimitiveRestart, IndexGeneratorSpeedTest, testing::Bool());
+
+TEST_P(IndexGeneratorSpeedTest, DISABLED_AddIndices)
+{
+  // Typical draw sizes, filling the index buffer before starting over like VertexManagerBase.
+  constexpr std::array<u32, 4> batch_sizes = {4, 32, 256, 4096};
+  constexpr std::array<int, 4> primitives = {
+      OpcodeDecoder::GX_DRAW_QUADS, OpcodeDecoder::GX_DRAW_TRIANGLES,
+      OpcodeDecoder::GX_DRAW_TRIANGLE_STRIP, OpcodeDecoder::GX_DRAW_TRIANGLE_FAN};
+  constexpr u32 total_verts = 1 << 22;
+
+  std::vector<u16> buffer(65536 * MAX_INDICES_PER_VERTEX);
+  for (int primitive : primitives)
+  {
+    for (u32 batch_size : batch_sizes)
+    {
+      m_generator.Start(buffer.data());
+      for (u32 verts = 0; verts < total_verts; verts += batch_size)
+      {
+        if (m_generator.GetRemainingIndices() < batch_size)
+          m_generator.Start(buffer.data());
+        m_generator.AddIndices(primitive, batch_size);
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/UberShaderPixel.h"
+#include "VideoCommon/UberShaderVertex.h"
+#include "VideoCommon/VideoCommon.h"
+
+TEST(ShaderCode, RecycledBuffersStartEmpty)
+{
+  {
+    ShaderCode code;
+    code.Write("first {}", 1);
+  }
+
+  ShaderCode code;
+  EXPECT_TRUE(code.GetBuffer().empty());
+  code.Write("second {}", 2);
+  EXPECT_EQ("second 2", code.GetBuffer());
+}
+
+TEST(ShaderCode, MoveKeepsContents)
+{
+  ShaderCode code;
+  code.Write("{} {}", "moved", 3);
+
+  const ShaderCode moved = std::move(code);
+  EXPECT_EQ("moved 3", moved.GetBuffer());
+}
+
+TEST(ShaderCode, RecycledBuffersGenerateSameSource)
+{
+  std::optional<UberShader::PixelShaderUid> pixel_uid;
+  UberShader::EnumeratePixelShaderUids([&pixel_uid](const UberShader::PixelShaderUid& uid) {
+    if (!pixel_uid)
+      pixel_uid = uid;
+  });
+  ASSERT_TRUE(pixel_uid);
+
+  const std::string source =
+      UberShader::GenPixelShader(APIType::Vulkan, {}, pixel_uid->GetUidData()).GetBuffer();
+
+  // Leave something else in the recycled buffers before generating the same shader again.
+  const std::string vertex_source =
+      UberShader::GenVertexShader(APIType::Vulkan, {}, UberShader::VertexShaderUid().GetUidData())
+          .GetBuffer();
+  EXPECT_NE(source, vertex_source);
+
+  EXPECT_EQ(source,
+            UberShader::GenPixelShader(APIType::Vulkan, {}, pixel_uid->GetUidData()).GetBuffer());
+}
+
+// Run with --gtest_also_run_disabled_tests to measure the shader generators, using the time gtest
+// reports.
+class ShaderGenSpeedTest : public testing::TestWithParam<APIType>
+{
+};
+
+INSTANTIATE_TEST_CASE_P(AllAPIs, ShaderGenSpeedTest,
+                        testing::Values(APIType::OpenGL, APIType::D3D, APIType::Vulkan));
+
+// Generates the source of every ubershader, as the shader cache does when precompiling them.
+TEST_P(ShaderGenSpeedTest, DISABLED_AllUberShaders)
+{
+  const APIType api_type = GetParam();
+  ShaderHostConfig host_config{};
+  host_config.backend_dual_source_blend = true;
+  host_config.backend_bitfield = true;
+  host_config.backend_dynamic_sampler_indexing = true;
+
+  UberShader::EnumerateVertexShaderUids([&](const UberShader::VertexShaderUid& uid) {
+    const ShaderCode code = UberShader::GenVertexShader(api_type, host_config, uid.GetUidData());
+    EXPECT_FALSE(code.GetBuffer().empty());
+  });
+  UberShader::EnumeratePixelShaderUids([&](const UberShader::PixelShaderUid& uid) {
+    const ShaderCode code = UberShader::GenPixelShader(api_type, host_config, uid.GetUidData());
+    EXPECT_FALSE(code.GetBuffer().empty());
+  });
+}
@@ -0,0 +1,117 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureCacheBase.h"
+
+namespace
+{
+using TexAddrCache = TextureCacheBase::TexAddrCache;
+
+// The largest possible GC texture, which the overlap search used to always look back by
+constexpr u32 MAX_GC_TEXTURE_SIZE = 1024 * 1024 * 4;
+constexpr u32 MEM1_SIZE = 24 * 1024 * 1024;
+
+struct Texture
+{
+  u32 address;
+  u32 size;
+};
+
+// Textures of random sizes up to max_size at random addresses in MEM1. The cache only needs the
+// addresses, so the entries are left null.
+std::vector<Texture> CreateTextures(size_t count, u32 max_size, std::mt19937& rng)
+{
+  std::uniform_int_distribution<u32> address_dist(0, MEM1_SIZE / 32 - 1);
+  std::uniform_int_distribution<u32> size_dist(1, max_size / 32);
+  std::vector<Texture> textures(count);
+  for (Texture& texture : textures)
+    texture = {address_dist(rng) * 32, size_dist(rng) * 32};
+  return textures;
+}
+
+TexAddrCache CreateCache(const std::vector<Texture>& textures)
+{
+  TexAddrCache cache;
+  for (const Texture& texture : textures)
+    cache.emplace(texture.address, nullptr);
+  return cache;
+}
+
+size_t CountOverlapCandidates(TexAddrCache& cache, u32 max_texture_size, u32 address, u32 size)
+{
+  const auto [begin, end] =
+      TextureCacheBase::FindOverlappingTextures(cache, max_texture_size, address, size);
+  return static_cast<size_t>(std::distance(begin, end));
+}
+}  // namespace
+
+TEST(TextureCacheTest, FindOverlappingTexturesFindsAllOverlaps)
+{
+  std::mt19937 rng(0);
+  const std::vector<Texture> textures = CreateTextures(2000, 64 * 1024, rng);
+  TexAddrCache cache = CreateCache(textures);
+  u32 max_size = 0;
+  for (const Texture& texture : textures)
+    max_size = std::max(max_size, texture.size);
+
+  std::uniform_int_distribution<u32> address_dist(0, MEM1_SIZE - 1);
+  for (int i = 0; i < 1000; ++i)
+  {
+    const u32 address = address_dist(rng);
+    const u32 size = 4096;
+    const auto [begin, end] =
+        TextureCacheBase::FindOverlappingTextures(cache, max_size, address, size);
+    for (const Texture& texture : textures)
+    {
+      if (texture.address >= address + size || texture.address + texture.size <= address)
+        continue;
+      EXPECT_TRUE(std::any_of(begin, end, [&texture](const auto& candidate) {
+        return candidate.first == texture.address;
+      }));
+    }
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests to compare the overlap search window of the largest
+// cached texture with the fixed window of the largest possible texture, using the time gtest
+// reports. The cache is full of small textures like most games have.
+class TextureCacheSpeedTest : public testing::Test
+{
+protected:
+  TextureCacheSpeedTest() : m_rng(0), m_textures(CreateTextures(4000, 16 * 1024, m_rng))
+  {
+    m_cache = CreateCache(m_textures);
+  }
+
+  void Search(u32 window)
+  {
+    std::uniform_int_distribution<u32> address_dist(0, MEM1_SIZE - 1);
+    for (int i = 0; i < 50000; ++i)
+      CountOverlapCandidates(m_cache, window, address_dist(m_rng), 4096);
+  }
+
+  std::mt19937 m_rng;
+  std::vector<Texture> m_textures;
+  TexAddrCache m_cache;
+};
+
+TEST_F(TextureCacheSpeedTest, DISABLED_LargestPossibleTexture)
+{
+  Search(MAX_GC_TEXTURE_SIZE);
+}
+
+TEST_F(TextureCacheSpeedTest, DISABLED_LargestCachedTexture)
+{
+  u32 max_size = 0;
+  for (const Texture& texture : m_textures)
+    max_size = std::max(max_size, texture.size);
+  Search(max_size);
+}
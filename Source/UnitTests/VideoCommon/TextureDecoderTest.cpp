@@ -0,0 +1,173 @@
+// Copyright 2026 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoderWorkers.h"
+
+namespace
+{
+constexpr int WIDTH = 64;
+constexpr int HEIGHT = 32;
+
+// C14X2 indexes up to 0x4000 entries. The AVX2 palette decoders may read 2 bytes past the last
+// entry, so leave some padding.
+constexpr size_t TLUT_SIZE = 0x4000 * sizeof(u16) + 16;
+
+using DecoderParams = std::tuple<TextureFormat, TLUTFormat>;
+
+std::vector<u8> RandomBytes(size_t size, std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(dist(rng));
+  return bytes;
+}
+}  // namespace
+
+// Checks the whole-texture decoders, including the SIMD paths selected at runtime, against the
+// per-texel reference decoder.
+class TextureDecoderTest : public testing::TestWithParam<DecoderParams>
+{
+protected:
+  void TearDown() override { cpu_info = CPUInfo(); }
+
+  void CheckAgainstTexelDecoder()
+  {
+    const auto [format, tlut_format] = GetParam();
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format), m_rng);
+    const std::vector<u8> tlut = RandomBytes(TLUT_SIZE, m_rng);
+
+    std::vector<u32> decoded(WIDTH * HEIGHT, 0xDEADBEEF);
+    TexDecoder_Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), WIDTH, HEIGHT, format,
+                      tlut.data(), tlut_format);
+
+    for (int t = 0; t < HEIGHT; t++)
+    {
+      for (int s = 0; s < WIDTH; s++)
+      {
+        u32 expected;
+        // The texel decoder takes the width minus one, as stored in the texture registers.
+        TexDecoder_DecodeTexel(reinterpret_cast<u8*>(&expected), src.data(), s, t, WIDTH - 1,
+                               format, tlut.data(), tlut_format);
+        ASSERT_EQ(expected, decoded[t * WIDTH + s]) << fmt::format("at ({}, {})", s, t);
+      }
+    }
+  }
+
+  std::mt19937 m_rng{static_cast<u32>(std::get<0>(GetParam())) * 16 +
+                     static_cast<u32>(std::get<1>(GetParam()))};
+};
+
+TEST_P(TextureDecoderTest, MatchesTexelDecoder)
+{
+  CheckAgainstTexelDecoder();
+}
+
+TEST_P(TextureDecoderTest, MatchesTexelDecoderWithoutAVX2)
+{
+  cpu_info.bAVX2 = false;
+  CheckAgainstTexelDecoder();
+}
+
+TEST_P(TextureDecoderTest, MatchesTexelDecoderWithoutSIMD)
+{
+  cpu_info.bAVX2 = false;
+  cpu_info.bSSSE3 = false;
+  CheckAgainstTexelDecoder();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NonPaletted, TextureDecoderTest,
+    testing::Combine(testing::Values(TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4,
+                                     TextureFormat::IA8, TextureFormat::RGB565,
+                                     TextureFormat::RGB5A3, TextureFormat::RGBA8,
+                                     TextureFormat::CMPR),
+                     testing::Values(TLUTFormat::IA8)));
+
+INSTANTIATE_TEST_CASE_P(
+    Paletted, TextureDecoderTest,
+    testing::Combine(testing::Values(TextureFormat::C4, TextureFormat::C8, TextureFormat::C14X2),
+                     testing::Values(TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3)));
+
+// Checks that decoding in bands on the worker threads gives the same result as decoding the
+// whole texture at once. The heights are multiples of 8 rows, but don't split evenly into bands.
+class TextureDecoderWorkersTest : public TextureDecoderTest
+{
+};
+INSTANTIATE_TEST_CASE_P(
+    AllFormats, TextureDecoderWorkersTest,
+    testing::Combine(testing::Values(TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4,
+                                     TextureFormat::IA8, TextureFormat::RGB565,
+                                     TextureFormat::RGB5A3, TextureFormat::RGBA8,
+                                     TextureFormat::CMPR, TextureFormat::C4, TextureFormat::C8,
+                                     TextureFormat::C14X2),
+                     testing::Values(TLUTFormat::RGB5A3)));
+
+TEST_P(TextureDecoderWorkersTest, MatchesSingleThreadedDecode)
+{
+  constexpr u32 width = 256;
+  const auto [format, tlut_format] = GetParam();
+  const std::vector<u8> tlut = RandomBytes(TLUT_SIZE, m_rng);
+
+  VideoCommon::TextureDecoderWorkers workers;
+  workers.ResizeWorkerThreads(3);
+
+  for (const u32 height : {8u, 136u, 264u, 520u})
+  {
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(width, height, format), m_rng);
+
+    std::vector<u32> expected(width * height, 0xDEADBEEF);
+    TexDecoder_Decode(reinterpret_cast<u8*>(expected.data()), src.data(), width, height, format,
+                      tlut.data(), tlut_format);
+
+    std::vector<u32> decoded(width * height, 0xDEADBEEF);
+    workers.Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), width, height, format,
+                   tlut.data(), tlut_format);
+
+    EXPECT_EQ(expected, decoded) << fmt::format("height {}", height);
+  }
+}
+
+// Run with --gtest_also_run_disabled_tests to compare the decoders, using the time gtest reports.
+class TextureDecoderSpeedTest : public TextureDecoderTest
+{
+};
+INSTANTIATE_TEST_CASE_P(
+    AllFormats, TextureDecoderSpeedTest,
+    testing::Combine(testing::Values(TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4,
+                                     TextureFormat::IA8, TextureFormat::RGB565,
+                                     TextureFormat::RGB5A3, TextureFormat::RGBA8,
+                                     TextureFormat::CMPR, TextureFormat::C4, TextureFormat::C8,
+                                     TextureFormat::C14X2),
+                     testing::Values(TLUTFormat::RGB5A3)));
+
+TEST_P(TextureDecoderSpeedTest, DISABLED_Decode512x512)
+{
+  constexpr int size = 512;
+  constexpr int iterations = 20;
+  const auto [format, tlut_format] = GetParam();
+  const std::vector<u8> src =
+      RandomBytes(TexDecoder_GetTextureSizeInBytes(size, size, format), m_rng);
+  const std::vector<u8> tlut = RandomBytes(TLUT_SIZE, m_rng);
+  std::vector<u32> decoded(size * size);
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    TexDecoder_Decode(reinterpret_cast<u8*>(decoded.data()), src.data(), size, size, format,
+                      tlut.data(), tlut_format);
+  }
+}
@@ -2,11 +2,13 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>  // NOLINT
 
@@ -17,6 +19,7 @@
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoaderWorkers.h"
 
 TEST(VertexLoaderUID, UniqueEnough)
 {
@@ -39,6 +42,25 @@ TEST(VertexLoaderUID, UniqueEnough)
   uids.insert(VertexLoaderUID(vtx_desc, vat));
 }
 
+TEST(VertexLoaderUID, RoundTripsThroughData)
+{
+  TVtxDesc vtx_desc;
+  vtx_desc.Hex = 0x1FEDCBA98ull;
+  VAT vat;
+  vat.g0.Hex = 0x01234567;
+  vat.g1.Hex = 0x89ABCDEF;
+  vat.g2.Hex = 0xDEADBEEF;
+
+  const VertexLoaderUID uid(vtx_desc, vat);
+  const VertexLoaderUID copy(uid.GetData());
+  EXPECT_EQ(uid, copy);
+  EXPECT_EQ(uid.GetHash(), copy.GetHash());
+  EXPECT_EQ(vtx_desc.Hex, copy.GetVtxDesc().Hex);
+  EXPECT_EQ(vat.g0.Hex, copy.GetVAT().g0.Hex);
+  EXPECT_EQ(vat.g1.Hex, copy.GetVAT().g1.Hex);
+  EXPECT_EQ(vat.g2.Hex, copy.GetVAT().g2.Hex);
+}
+
 static u8 input_memory[16 * 1024 * 1024];
 static u8 output_memory[16 * 1024 * 1024];
 
@@ -245,6 +267,116 @@ TEST_F(VertexLoaderTest, PositionIndex16FloatXY)
   ExpectOut(2);
 }
 
+TEST_F(VertexLoaderTest, WorkersMatchSingleThread)
+{
+  m_vtx_desc.PosMatIdx = 1;
+  m_vtx_desc.Position = INDEX16;
+  m_vtx_attr.g0.PosElements = 1;  // XYZ
+  m_vtx_attr.g0.PosFormat = FORMAT_FLOAT;
+  CreateAndCheckSizes(1 + sizeof(u16), 3 * sizeof(float) + sizeof(u32));
+  if (!m_loader->IsReentrant())
+    return;
+
+  // Every 100th vertex has the skip index, so the bands have gaps to close.
+  constexpr int count = 10000;
+  constexpr int num_positions = 256;
+  constexpr int expected_count = count - count / 100;
+  for (int i = 0; i < count; i++)
+  {
+    Input<u8>(i % 64);
+    Input<u16>(i % 100 == 50 ? 0xFFFF : (i * 7) % num_positions);
+  }
+  VertexLoaderManager::cached_arraybases[ARRAY_POSITION] = m_src.GetPointer();
+  g_main_cp_state.array_strides[ARRAY_POSITION] = 3 * sizeof(float);
+  for (int i = 0; i < num_positions * 3; i++)
+    Input(static_cast<float>(i));
+
+  const size_t output_size = expected_count * m_loader->m_native_vtx_decl.stride;
+  RunVertices(count, expected_count);
+  const std::vector<u8> expected_output(output_memory, output_memory + output_size);
+  float expected_position_cache[3][4];
+  std::memcpy(expected_position_cache, VertexLoaderManager::position_cache,
+              sizeof(expected_position_cache));
+  u32 expected_position_matrix_index[4];
+  std::memcpy(expected_position_matrix_index, VertexLoaderManager::position_matrix_index,
+              sizeof(expected_position_matrix_index));
+
+  std::memset(output_memory, 0xFF, output_size);
+  std::memset(VertexLoaderManager::position_cache, 0, sizeof(VertexLoaderManager::position_cache));
+  std::memset(VertexLoaderManager::position_matrix_index, 0,
+              sizeof(VertexLoaderManager::position_matrix_index));
+
+  VideoCommon::VertexLoaderWorkers workers;
+  workers.ResizeWorkerThreads(3);
+  ResetPointers();
+  EXPECT_EQ(expected_count, workers.RunVertices(m_loader.get(), m_src, m_dst, count));
+  EXPECT_EQ(0, std::memcmp(expected_output.data(), output_memory, output_size));
+  EXPECT_EQ(0, std::memcmp(expected_position_cache, VertexLoaderManager::position_cache,
+                           sizeof(expected_position_cache)));
+  EXPECT_EQ(0, std::memcmp(expected_position_matrix_index,
+                           VertexLoaderManager::position_matrix_index,
+                           sizeof(expected_position_matrix_index)));
+  EXPECT_EQ(2 * count, m_loader->m_numLoadedVertices.load());
+}
+
+// The workers convert the vertices after the end of each band on other threads, so the loaders
+// must not write past the last attribute of a vertex. Attributes with three components are the
+// ones that a vector store could overrun.
+class VertexLoaderWorkersTest : public VertexLoaderTest,
+                                public ::testing::WithParamInterface<int>
+{
+};
+// Position, normal, and texture matrix index without a coordinate
+INSTANTIATE_TEST_CASE_P(LastAttribute, VertexLoaderWorkersTest, ::testing::Values(0, 1, 2));
+
+TEST_P(VertexLoaderWorkersTest, ThreeComponentsLast)
+{
+  m_vtx_desc.Position = DIRECT;
+  m_vtx_attr.g0.PosElements = 1;  // XYZ
+  m_vtx_attr.g0.PosFormat = FORMAT_SHORT;
+  m_vtx_attr.g0.PosFrac = 4;
+  size_t input_size = 3 * sizeof(s16);
+  size_t output_size = 3 * sizeof(float);
+  if (GetParam() == 1)
+  {
+    m_vtx_desc.Normal = DIRECT;
+    m_vtx_attr.g0.NormalFormat = FORMAT_BYTE;
+    input_size += 3 * sizeof(s8);
+    output_size += 3 * sizeof(float);
+  }
+  else if (GetParam() == 2)
+  {
+    m_vtx_desc.Tex0MatIdx = 1;
+    input_size += sizeof(u8);
+    output_size += 3 * sizeof(float);
+  }
+  CreateAndCheckSizes(input_size, output_size);
+
+  constexpr int count = 10000;
+  for (size_t i = 0; i < count * input_size; i++)
+    Input<u8>(static_cast<u8>(i * 37 + i / 7));
+
+  const size_t total_output_size = count * output_size;
+  RunVertices(count);
+  for (size_t i = total_output_size; i < total_output_size + 16; i++)
+    ASSERT_EQ(0xFF, output_memory[i]) << "wrote past the last vertex";
+  if (!m_loader->IsReentrant())
+    return;
+
+  const std::vector<u8> expected_output(output_memory, output_memory + total_output_size);
+  std::memset(output_memory, 0xFF, total_output_size);
+
+  // Four bands
+  VideoCommon::VertexLoaderWorkers workers;
+  workers.ResizeWorkerThreads(3);
+  for (int i = 0; i < 20; i++)
+  {
+    ResetPointers();
+    EXPECT_EQ(count, workers.RunVertices(m_loader.get(), m_src, m_dst, count));
+    EXPECT_EQ(0, std::memcmp(expected_output.data(), output_memory, total_output_size));
+  }
+}
+
 class VertexLoaderSpeedTest : public VertexLoaderTest,
                               public ::testing::WithParamInterface<std::tuple<int, int>>
 {